@@ -0,0 +1,642 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <iterator>
+#include <utility>
+
+/*
+    B+ Tree sebagai alternatif RBTree untuk index terurut
+
+    Setiap node menyimpan banyak nilai dalam satu array (node lebar) sehingga tree jauh lebih pendek daripada RBTree
+    Pencarian cukup membaca beberapa node yang isinya berdekatan di memori, bukan satu node per level
+    - Inner node hanya berisi kunci pemisah dan pointer anak
+    - Semua nilai berada di leaf, dan leaf saling terhubung (prev, next)
+      sehingga penelusuran terurut dan pencarian rentang cukup berjalan dari leaf ke leaf
+
+    Aturan kunci pemisah: anak ke-i berisi nilai v dengan keys[i - 1] <= v < keys[i]
+    Kunci pemisah adalah salinan nilai, sehingga tetap berlaku walaupun nilai aslinya sudah dihapus
+
+    Berbeda dengan RBTree, nilai berpindah tempat saat insert dan remove (digeser atau dipindah ke node lain)
+    Pointer dan iterator ke nilai tidak berlaku lagi setelah tree diubah
+*/
+
+/**
+ * B+ Tree
+ * T = Tipe Data Nilai, harus mempunyai default constructor
+ * K = Pembanding, sama dengan RBTree: class dengan fungsi int compare(const T &a, const T &b)
+ * NodeBytes = Perkiraan ukuran array nilai di setiap node dalam byte (kelipatan cache line 64 byte), minimal 4 nilai per node
+ * Default 2048 byte, misalnya 512 int atau 16 Product (4 std::wstring) per leaf
+ */
+template <typename T, typename K, size_t NodeBytes = 2048>
+struct BPlusTree
+{
+    static constexpr size_t capacity = NodeBytes / sizeof(T) < 4 ? 4 : NodeBytes / sizeof(T);
+    // Node selain root tidak boleh berisi kurang dari minCount nilai (leaf) atau kunci (inner)
+    static constexpr size_t minCount = capacity / 2;
+
+    /**
+     * Array mempunyai satu tempat lebih untuk sementara menampung nilai sebelum node dipecah (split)
+     */
+    struct Leaf
+    {
+        size_t count = 0;
+        Leaf *prev = nullptr, *next = nullptr;
+        T values[capacity + 1];
+    };
+
+    struct Inner
+    {
+        size_t count = 0;
+        T keys[capacity + 1];
+        void *children[capacity + 2];
+    };
+
+    // Hasil pemecahan node, node baru berada di kanan dan berisi nilai >= key
+    struct Split
+    {
+        T key;
+        void *node;
+    };
+
+    // Leaf atau Inner, ditentukan oleh height
+    void *root = nullptr;
+    // 0 jika root adalah leaf
+    int height = 0;
+    size_t count = 0;
+    Leaf *head = nullptr, *tail = nullptr;
+    K comparer;
+
+    BPlusTree()
+    {
+    }
+
+    BPlusTree(const BPlusTree &) = delete;
+    BPlusTree &operator=(const BPlusTree &) = delete;
+
+    ~BPlusTree()
+    {
+        clear();
+    }
+
+    void clear()
+    {
+        if (root != nullptr)
+            freeNode(root, height);
+        root = nullptr;
+        height = 0;
+        count = 0;
+        head = nullptr;
+        tail = nullptr;
+    }
+
+    void freeNode(void *node, int level)
+    {
+        if (level == 0)
+        {
+            delete static_cast<Leaf *>(node);
+            return;
+        }
+
+        Inner *inner = static_cast<Inner *>(node);
+        for (size_t i = 0; i <= inner->count; i++)
+            freeNode(inner->children[i], level - 1);
+        delete inner;
+    }
+
+    // Index pertama dengan values[i] >= value
+    size_t lowerIndex(const T *values, size_t n, const T &value)
+    {
+        size_t low = 0, high = n;
+        while (low < high)
+        {
+            size_t mid = (low + high) / 2;
+            if (comparer.compare(values[mid], value) < 0)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low;
+    }
+
+    // Index pertama dengan values[i] > value
+    size_t upperIndex(const T *values, size_t n, const T &value)
+    {
+        size_t low = 0, high = n;
+        while (low < high)
+        {
+            size_t mid = (low + high) / 2;
+            if (comparer.compare(values[mid], value) <= 0)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low;
+    }
+
+    // Leaf yang mungkin berisi value
+    Leaf *findLeaf(const T &value)
+    {
+        void *node = root;
+        for (int level = height; level > 0; level--)
+        {
+            Inner *inner = static_cast<Inner *>(node);
+            node = inner->children[upperIndex(inner->keys, inner->count, value)];
+        }
+        return static_cast<Leaf *>(node);
+    }
+
+    /**
+     * Mengembalikan pointer ke nilai yang sama dengan value, nullptr jika tidak ada
+     */
+    T *findNode(const T &value)
+    {
+        if (root == nullptr)
+            return nullptr;
+
+        Leaf *leaf = findLeaf(value);
+        size_t i = lowerIndex(leaf->values, leaf->count, value);
+        if (i < leaf->count && comparer.compare(leaf->values[i], value) == 0)
+            return &leaf->values[i];
+        return nullptr;
+    }
+
+    /**
+     * Melempar std::domain_error("Value has been added") jika nilai yang sama sudah ada
+     */
+    void insert(T &&value)
+    {
+        if (root == nullptr)
+        {
+            Leaf *leaf = new Leaf();
+            leaf->values[0] = std::move(value);
+            leaf->count = 1;
+            root = leaf;
+            head = leaf;
+            tail = leaf;
+            count = 1;
+            return;
+        }
+
+        Split split;
+        if (insertInto(root, height, value, split))
+        {
+            Inner *newRoot = new Inner();
+            newRoot->keys[0] = std::move(split.key);
+            newRoot->children[0] = root;
+            newRoot->children[1] = split.node;
+            newRoot->count = 1;
+            root = newRoot;
+            height++;
+        }
+        count++;
+    }
+
+    // Mengembalikan true jika node dipecah, hasilnya di split
+    bool insertInto(void *node, int level, T &value, Split &split)
+    {
+        if (level == 0)
+        {
+            Leaf *leaf = static_cast<Leaf *>(node);
+            size_t i = lowerIndex(leaf->values, leaf->count, value);
+            if (i < leaf->count && comparer.compare(leaf->values[i], value) == 0)
+                throw std::domain_error("Value has been added");
+
+            for (size_t j = leaf->count; j > i; j--)
+                leaf->values[j] = std::move(leaf->values[j - 1]);
+            leaf->values[i] = std::move(value);
+            leaf->count++;
+
+            if (leaf->count <= capacity)
+                return false;
+
+            splitLeaf(leaf, split);
+            return true;
+        }
+
+        Inner *inner = static_cast<Inner *>(node);
+        size_t i = upperIndex(inner->keys, inner->count, value);
+
+        Split childSplit;
+        if (!insertInto(inner->children[i], level - 1, value, childSplit))
+            return false;
+
+        for (size_t j = inner->count; j > i; j--)
+        {
+            inner->keys[j] = std::move(inner->keys[j - 1]);
+            inner->children[j + 1] = inner->children[j];
+        }
+        inner->keys[i] = std::move(childSplit.key);
+        inner->children[i + 1] = childSplit.node;
+        inner->count++;
+
+        if (inner->count <= capacity)
+            return false;
+
+        splitInner(inner, split);
+        return true;
+    }
+
+    void splitLeaf(Leaf *leaf, Split &split)
+    {
+        Leaf *right = new Leaf();
+        size_t mid = leaf->count / 2;
+
+        for (size_t j = mid; j < leaf->count; j++)
+        {
+            right->values[j - mid] = std::move(leaf->values[j]);
+            leaf->values[j] = T();
+        }
+        right->count = leaf->count - mid;
+        leaf->count = mid;
+
+        right->prev = leaf;
+        right->next = leaf->next;
+        if (leaf->next != nullptr)
+            leaf->next->prev = right;
+        else
+            tail = right;
+        leaf->next = right;
+
+        split.key = right->values[0];
+        split.node = right;
+    }
+
+    void splitInner(Inner *inner, Split &split)
+    {
+        Inner *right = new Inner();
+        size_t mid = inner->count / 2;
+
+        // Kunci tengah dinaikkan ke parent, tidak disimpan di kedua node
+        split.key = std::move(inner->keys[mid]);
+        inner->keys[mid] = T();
+
+        for (size_t j = mid + 1; j < inner->count; j++)
+        {
+            right->keys[j - mid - 1] = std::move(inner->keys[j]);
+            inner->keys[j] = T();
+        }
+        for (size_t j = mid + 1; j <= inner->count; j++)
+            right->children[j - mid - 1] = inner->children[j];
+
+        right->count = inner->count - mid - 1;
+        inner->count = mid;
+        split.node = right;
+    }
+
+    bool remove(const T &value)
+    {
+        if (root == nullptr || !removeFrom(root, height, value))
+            return false;
+
+        count--;
+
+        if (height == 0)
+        {
+            Leaf *leaf = static_cast<Leaf *>(root);
+            if (leaf->count == 0)
+            {
+                delete leaf;
+                root = nullptr;
+                head = nullptr;
+                tail = nullptr;
+            }
+        }
+        else
+        {
+            Inner *inner = static_cast<Inner *>(root);
+            if (inner->count == 0)
+            {
+                root = inner->children[0];
+                height--;
+                delete inner;
+            }
+        }
+
+        return true;
+    }
+
+    bool removeFrom(void *node, int level, const T &value)
+    {
+        if (level == 0)
+        {
+            Leaf *leaf = static_cast<Leaf *>(node);
+            size_t i = lowerIndex(leaf->values, leaf->count, value);
+            if (i == leaf->count || comparer.compare(leaf->values[i], value) != 0)
+                return false;
+
+            for (size_t j = i + 1; j < leaf->count; j++)
+                leaf->values[j - 1] = std::move(leaf->values[j]);
+            leaf->count--;
+            leaf->values[leaf->count] = T();
+            return true;
+        }
+
+        Inner *inner = static_cast<Inner *>(node);
+        size_t i = upperIndex(inner->keys, inner->count, value);
+        if (!removeFrom(inner->children[i], level - 1, value))
+            return false;
+
+        if (level == 1)
+        {
+            if (static_cast<Leaf *>(inner->children[i])->count < minCount)
+                fixLeaf(inner, i);
+        }
+        else
+        {
+            if (static_cast<Inner *>(inner->children[i])->count < minCount)
+                fixInner(inner, i);
+        }
+        return true;
+    }
+
+    // Menghapus kunci ke-i dan anak ke-(i + 1) dari inner
+    void removeEntry(Inner *inner, size_t i)
+    {
+        for (size_t j = i + 1; j < inner->count; j++)
+        {
+            inner->keys[j - 1] = std::move(inner->keys[j]);
+            inner->children[j] = inner->children[j + 1];
+        }
+        inner->count--;
+        inner->keys[inner->count] = T();
+    }
+
+    // Leaf anak ke-i dari parent kekurangan nilai, pinjam dari saudara atau gabungkan
+    void fixLeaf(Inner *parent, size_t i)
+    {
+        Leaf *child = static_cast<Leaf *>(parent->children[i]);
+        Leaf *left = i > 0 ? static_cast<Leaf *>(parent->children[i - 1]) : nullptr;
+        Leaf *right = i < parent->count ? static_cast<Leaf *>(parent->children[i + 1]) : nullptr;
+
+        if (left != nullptr && left->count > minCount)
+        {
+            for (size_t j = child->count; j > 0; j--)
+                child->values[j] = std::move(child->values[j - 1]);
+            left->count--;
+            child->values[0] = std::move(left->values[left->count]);
+            left->values[left->count] = T();
+            child->count++;
+            parent->keys[i - 1] = child->values[0];
+        }
+        else if (right != nullptr && right->count > minCount)
+        {
+            child->values[child->count] = std::move(right->values[0]);
+            child->count++;
+            for (size_t j = 1; j < right->count; j++)
+                right->values[j - 1] = std::move(right->values[j]);
+            right->count--;
+            right->values[right->count] = T();
+            parent->keys[i] = right->values[0];
+        }
+        else if (left != nullptr)
+        {
+            mergeLeaf(left, child);
+            removeEntry(parent, i - 1);
+        }
+        else
+        {
+            mergeLeaf(child, right);
+            removeEntry(parent, i);
+        }
+    }
+
+    // Memindahkan seluruh isi right ke left lalu menghapus right
+    void mergeLeaf(Leaf *left, Leaf *right)
+    {
+        for (size_t j = 0; j < right->count; j++)
+            left->values[left->count + j] = std::move(right->values[j]);
+        left->count += right->count;
+
+        left->next = right->next;
+        if (right->next != nullptr)
+            right->next->prev = left;
+        else
+            tail = left;
+        delete right;
+    }
+
+    // Inner anak ke-i dari parent kekurangan kunci, pinjam dari saudara atau gabungkan
+    void fixInner(Inner *parent, size_t i)
+    {
+        Inner *child = static_cast<Inner *>(parent->children[i]);
+        Inner *left = i > 0 ? static_cast<Inner *>(parent->children[i - 1]) : nullptr;
+        Inner *right = i < parent->count ? static_cast<Inner *>(parent->children[i + 1]) : nullptr;
+
+        if (left != nullptr && left->count > minCount)
+        {
+            for (size_t j = child->count; j > 0; j--)
+                child->keys[j] = std::move(child->keys[j - 1]);
+            for (size_t j = child->count + 1; j > 0; j--)
+                child->children[j] = child->children[j - 1];
+
+            child->keys[0] = std::move(parent->keys[i - 1]);
+            child->children[0] = left->children[left->count];
+            child->count++;
+
+            left->count--;
+            parent->keys[i - 1] = std::move(left->keys[left->count]);
+            left->keys[left->count] = T();
+        }
+        else if (right != nullptr && right->count > minCount)
+        {
+            child->keys[child->count] = std::move(parent->keys[i]);
+            child->children[child->count + 1] = right->children[0];
+            child->count++;
+
+            parent->keys[i] = std::move(right->keys[0]);
+            for (size_t j = 1; j < right->count; j++)
+                right->keys[j - 1] = std::move(right->keys[j]);
+            for (size_t j = 1; j <= right->count; j++)
+                right->children[j - 1] = right->children[j];
+            right->count--;
+            right->keys[right->count] = T();
+        }
+        else if (left != nullptr)
+        {
+            mergeInner(left, child, parent->keys[i - 1]);
+            removeEntry(parent, i - 1);
+        }
+        else
+        {
+            mergeInner(child, right, parent->keys[i]);
+            removeEntry(parent, i);
+        }
+    }
+
+    // Menggabungkan left, kunci pemisah dari parent, dan right ke left lalu menghapus right
+    void mergeInner(Inner *left, Inner *right, T &separator)
+    {
+        left->keys[left->count] = std::move(separator);
+        for (size_t j = 0; j < right->count; j++)
+            left->keys[left->count + 1 + j] = std::move(right->keys[j]);
+        for (size_t j = 0; j <= right->count; j++)
+            left->children[left->count + 1 + j] = right->children[j];
+        left->count += right->count + 1;
+        delete right;
+    }
+
+    /**
+     * Iterator inorder (terurut) dua arah, berjalan dari leaf ke leaf
+     * end() adalah leaf nullptr, --end() adalah nilai terbesar
+     * Tidak berlaku lagi setelah insert atau remove
+     */
+    struct Iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        BPlusTree *tree;
+        Leaf *leaf;
+        size_t index;
+
+        T &operator*() const
+        {
+            return leaf->values[index];
+        }
+
+        T *operator->() const
+        {
+            return &leaf->values[index];
+        }
+
+        Iterator &operator++()
+        {
+            index++;
+            if (index == leaf->count)
+            {
+                leaf = leaf->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        Iterator &operator--()
+        {
+            if (leaf == nullptr)
+            {
+                leaf = tree->tail;
+                index = leaf->count - 1;
+            }
+            else if (index == 0)
+            {
+                leaf = leaf->prev;
+                index = leaf->count - 1;
+            }
+            else
+            {
+                index--;
+            }
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return leaf == other.leaf && index == other.index;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return !(*this == other);
+        }
+    };
+
+    Iterator begin()
+    {
+        return Iterator{this, head, 0};
+    }
+
+    Iterator end()
+    {
+        return Iterator{this, nullptr, 0};
+    }
+
+    // Iterator ke leaf dan index, pindah ke leaf berikutnya jika index berada di akhir leaf
+    Iterator makeIterator(Leaf *leaf, size_t index)
+    {
+        if (index == leaf->count)
+            return Iterator{this, leaf->next, 0};
+        return Iterator{this, leaf, index};
+    }
+
+    // Iterator ke nilai pertama yang tidak lebih kecil dari value
+    Iterator lowerBound(const T &value)
+    {
+        if (root == nullptr)
+            return end();
+
+        Leaf *leaf = findLeaf(value);
+        return makeIterator(leaf, lowerIndex(leaf->values, leaf->count, value));
+    }
+
+    // Iterator ke nilai pertama yang lebih besar dari value
+    Iterator upperBound(const T &value)
+    {
+        if (root == nullptr)
+            return end();
+
+        Leaf *leaf = findLeaf(value);
+        return makeIterator(leaf, upperIndex(leaf->values, leaf->count, value));
+    }
+
+    /**
+     * Mengunjungi nilai dengan from <= nilai <= to secara terurut
+     * Signature visitor void visit(T *value), sama seperti RBTree tetapi menerima pointer ke nilai
+     */
+    template <typename Visit>
+    void findBetween(const T &from, const T &to, Visit visit)
+    {
+        if (root == nullptr)
+            return;
+
+        Leaf *leaf = findLeaf(from);
+        size_t i = lowerIndex(leaf->values, leaf->count, from);
+
+        // Seluruh leaf diperiksa tanpa perbandingan jika nilai terakhirnya masih <= to
+        while (leaf != nullptr)
+        {
+            if (comparer.compare(leaf->values[leaf->count - 1], to) <= 0)
+            {
+                for (; i < leaf->count; i++)
+                    visit(&leaf->values[i]);
+            }
+            else
+            {
+                for (; i < leaf->count && comparer.compare(leaf->values[i], to) <= 0; i++)
+                    visit(&leaf->values[i]);
+                return;
+            }
+
+            leaf = leaf->next;
+            i = 0;
+        }
+    }
+
+    // Mengunjungi seluruh nilai secara terurut, signature visitor void visit(T *value)
+    template <typename Visit>
+    void inorder(Visit visit)
+    {
+        for (Leaf *leaf = head; leaf != nullptr; leaf = leaf->next)
+        {
+            for (size_t i = 0; i < leaf->count; i++)
+                visit(&leaf->values[i]);
+        }
+    }
+};
@@ -0,0 +1,172 @@
+#include "BPlusTree.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <set>
+
+struct IntCompare
+{
+    int compare(const int &a, const int &b)
+    {
+        return a - b;
+    }
+};
+
+struct StringCompare
+{
+    int compare(const std::string &a, const std::string &b)
+    {
+        return a.compare(b);
+    }
+};
+
+/**
+ * Memeriksa aturan B+ Tree pada subtree node:
+ * urutan nilai, batas kunci pemisah, jumlah minimal isi node, dan kedalaman leaf yang sama
+ * Leaf dikumpulkan secara berurutan ke leaves untuk memeriksa hubungan prev dan next
+ */
+template <typename Tree>
+bool checkNode(Tree &tree, void *node, int level, const int *low, const int *high, bool isRoot, std::vector<typename Tree::Leaf *> &leaves)
+{
+    if (level == 0)
+    {
+        typename Tree::Leaf *leaf = static_cast<typename Tree::Leaf *>(node);
+        if (leaf->count > Tree::capacity || (!isRoot && leaf->count < Tree::minCount))
+            return false;
+        for (size_t i = 0; i < leaf->count; i++)
+        {
+            if (i > 0 && leaf->values[i - 1] >= leaf->values[i])
+                return false;
+            if ((low != nullptr && leaf->values[i] < *low) || (high != nullptr && leaf->values[i] >= *high))
+                return false;
+        }
+        leaves.push_back(leaf);
+        return true;
+    }
+
+    typename Tree::Inner *inner = static_cast<typename Tree::Inner *>(node);
+    if (inner->count > Tree::capacity || (!isRoot && inner->count < Tree::minCount) || inner->count == 0)
+        return false;
+
+    for (size_t i = 0; i <= inner->count; i++)
+    {
+        const int *childLow = i == 0 ? low : &inner->keys[i - 1];
+        const int *childHigh = i == inner->count ? high : &inner->keys[i];
+        if (!checkNode(tree, inner->children[i], level - 1, childLow, childHigh, false, leaves))
+            return false;
+    }
+    return true;
+}
+
+template <typename Tree>
+bool valid(Tree &tree)
+{
+    if (tree.root == nullptr)
+        return tree.count == 0 && tree.head == nullptr && tree.tail == nullptr;
+
+    std::vector<typename Tree::Leaf *> leaves;
+    if (!checkNode(tree, tree.root, tree.height, nullptr, nullptr, true, leaves))
+        return false;
+
+    size_t total = 0;
+    for (size_t i = 0; i < leaves.size(); i++)
+    {
+        if (leaves[i]->prev != (i == 0 ? nullptr : leaves[i - 1]))
+            return false;
+        if (leaves[i]->next != (i + 1 == leaves.size() ? nullptr : leaves[i + 1]))
+            return false;
+        total += leaves[i]->count;
+    }
+    return tree.head == leaves.front() && tree.tail == leaves.back() && total == tree.count;
+}
+
+int main()
+{
+    // Node kecil (4 nilai) agar tree cepat menjadi tinggi dan semua kasus pinjam / gabung terjadi
+    BPlusTree<int, IntCompare, 16> tree;
+    std::set<int> reference;
+    bool ok = true;
+
+    for (int x = 0; x < 20000; x++)
+    {
+        int value = (x * 7919) % 10007;
+        if (reference.insert(value).second)
+            tree.insert(std::move(value));
+        else
+        {
+            try
+            {
+                tree.insert(std::move(value));
+                ok = false;
+            }
+            catch (const std::domain_error &)
+            {
+            }
+        }
+    }
+    std::cout << "Insert count " << tree.count << ", height " << tree.height << ", valid " << (ok && valid(tree)) << std::endl;
+
+    for (int x = 0; x < 30000; x++)
+    {
+        int value = static_cast<int>(x * 104729LL % 12000);
+        bool removed = tree.remove(value);
+        ok = ok && removed == (reference.erase(value) == 1);
+        if (x % 1000 == 0)
+            ok = ok && valid(tree);
+        if (x % 3 == 0)
+        {
+            int added = (x * 31) % 12000;
+            if (reference.insert(added).second)
+                tree.insert(std::move(added));
+        }
+    }
+    std::vector<int> expected(reference.begin(), reference.end());
+    std::vector<int> forward(tree.begin(), tree.end());
+    std::vector<int> backward;
+    for (auto it = tree.end(); it != tree.begin();)
+        backward.push_back(*--it);
+    std::vector<int> backwardExpected(expected.rbegin(), expected.rend());
+    std::cout << "Remove count " << tree.count << ", valid " << (ok && valid(tree)) << ", forward " << (forward == expected)
+              << ", backward " << (backward == backwardExpected) << std::endl;
+
+    bool found = true;
+    for (int value = -1; value <= 12001; value++)
+    {
+        int *p = tree.findNode(value);
+        found = found && (p != nullptr) == (reference.count(value) == 1) && (p == nullptr || *p == value);
+
+        auto lower = reference.lower_bound(value);
+        auto upper = reference.upper_bound(value);
+        auto treeLower = tree.lowerBound(value);
+        auto treeUpper = tree.upperBound(value);
+        found = found && (lower == reference.end() ? treeLower == tree.end() : *treeLower == *lower);
+        found = found && (upper == reference.end() ? treeUpper == tree.end() : *treeUpper == *upper);
+    }
+
+    std::vector<int> between, expectedBetween;
+    tree.findBetween(1000, 5000, [&](int *value)
+                     { between.push_back(*value); });
+    for (int value : reference)
+    {
+        if (value >= 1000 && value <= 5000)
+            expectedBetween.push_back(value);
+    }
+    std::cout << "Find valid " << found << ", between " << (between == expectedBetween) << std::endl;
+
+    for (int value : expected)
+        tree.remove(value);
+    std::cout << "Remove all count " << tree.count << ", valid " << valid(tree) << ", empty " << (tree.begin() == tree.end()) << std::endl;
+
+    // Nilai dengan alokasi sendiri, dijalankan dengan sanitizer untuk memeriksa kebocoran memori
+    BPlusTree<std::string, StringCompare> stringTree;
+    for (int x = 0; x < 5000; x++)
+        stringTree.insert(std::string(40, 'a') + std::to_string(x));
+    for (int x = 0; x < 5000; x += 2)
+        stringTree.remove(std::string(40, 'a') + std::to_string(x));
+
+    size_t visited = 0;
+    stringTree.inorder([&](std::string *)
+                       { visited++; });
+    std::cout << "String tree count " << stringTree.count << ", visited " << visited
+              << ", found " << (stringTree.findNode(std::string(40, 'a') + "1") != nullptr) << std::endl;
+}
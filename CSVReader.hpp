@@ -12,20 +12,39 @@
 #include <iostream>
 #include <cctype>
 #include <algorithm>
-// #include <thread>
-// #include <mutex>
-// #include <condition_variable>
+#include <type_traits>
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
 #include "Utils.hpp"
-#include <Windows.h>
+#include "CSVScanner.hpp"
+#include "SPSCQueue.hpp"
+#include "HalfSipHash.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 constexpr size_t sCSVReaderIOBuffSize = 256 * 1024;
+constexpr size_t sCSVReaderIOMaxQueueDepth = 64;
 
 struct CSVReaderIOBuffSync
 {
+    static constexpr bool isMapped = false;
+
     std::ifstream stream;
     size_t bufferIndex = 0;
     size_t bufferSize = 0;
     std::vector<char> buffer = std::vector<char>(sCSVReaderIOBuffSize);
+    // Posisi byte awal buffer di file
+    size_t bufferOffset = 0;
     bool isEOf = false;
 
     void open(const std::string &filename)
@@ -40,6 +59,7 @@ struct CSVReaderIOBuffSync
 
     void fillBuffer()
     {
+        bufferOffset += bufferSize;
         bufferIndex = 0;
         stream.read(buffer.data(), sCSVReaderIOBuffSize);
         bufferSize = stream.gcount();
@@ -67,15 +87,219 @@ struct CSVReaderIOBuffSync
         }
     }
 
+    char *peekSpan(size_t &size)
+    {
+        size = isEOf ? 0 : bufferSize - bufferIndex;
+        return buffer.data() + bufferIndex;
+    }
+
+    void skip(size_t size)
+    {
+        bufferIndex += size;
+        if (bufferIndex == bufferSize)
+        {
+            fillBuffer();
+        }
+    }
+
+    bool eof()
+    {
+        return isEOf;
+    }
+
+    size_t offset()
+    {
+        return bufferOffset + bufferIndex;
+    }
+};
+
+/**
+ * Seperti CSVReaderIOBuffSync, tetapi buffer diisi oleh thread lain (read-ahead)
+ * Selama parser membaca satu buffer, thread pembaca mengisi buffer berikutnya
+ * sehingga pembacaan disk dan parsing berjalan bersamaan
+ *
+ * Buffer diserahkan antar thread dengan 2 SPSCQueue:
+ * - filledQueue, buffer yang sudah diisi (thread pembaca -> parser)
+ * - freeQueue, buffer yang sudah selesai dibaca dan bisa diisi ulang (parser -> thread pembaca)
+ * Jumlah buffer sama dengan queueDepth sehingga kedua queue tidak pernah overflow
+ * Thread yang mendapati queue kosong tidur (condition variable) dan dibangunkan setelah push,
+ * sehingga selama menunggu disk tidak ada thread yang berputar memakan CPU
+ *
+ * bufferSize dan queueDepth dapat diubah sebelum open dipanggil (reader.io.bufferSize = ...)
+ * Queue disimpan langsung (bukan new) karena SPSCQueue memakai alignas(64) yang tidak dijamin oleh new di C++11,
+ * kapasitasnya tetap sCSVReaderIOMaxQueueDepth dan queueDepth dibatasi nilai tersebut
+ */
+struct CSVReaderIOBuffAsync
+{
+    static constexpr bool isMapped = false;
+
+    struct Block
+    {
+        std::vector<char> data;
+        size_t size = 0;
+    };
+
+    size_t bufferSize = sCSVReaderIOBuffSize;
+    size_t queueDepth = 4;
+
+    std::ifstream stream;
+    std::vector<Block> blocks;
+    SPSCQueue<Block *> filledQueue{sCSVReaderIOMaxQueueDepth};
+    SPSCQueue<Block *> freeQueue{sCSVReaderIOMaxQueueDepth};
+    std::thread thread;
+    std::atomic<bool> stopping{false};
+
+    // Hanya untuk tidur dan membangunkan, isi queue tetap diserahkan tanpa lock
+    std::mutex signalMutex;
+    std::condition_variable filledSignal;
+    std::condition_variable freeSignal;
+
+    Block *current = nullptr;
+    size_t bufferIndex = 0;
+    // Posisi byte awal buffer sekarang di file
+    size_t bufferOffset = 0;
+    bool isEOf = false;
+
+    ~CSVReaderIOBuffAsync()
+    {
+        {
+            std::lock_guard<std::mutex> lock(signalMutex);
+            stopping = true;
+        }
+        freeSignal.notify_one();
+
+        if (thread.joinable())
+            thread.join();
+    }
+
+    void open(const std::string &filename)
+    {
+        stream.open(filename);
+
+        if (!stream)
+            throw std::domain_error("File not found");
+
+        queueDepth = std::min(std::max<size_t>(queueDepth, 2), sCSVReaderIOMaxQueueDepth);
+        blocks = std::vector<Block>(queueDepth);
+
+        for (Block &block : blocks)
+        {
+            block.data.resize(bufferSize);
+            freeQueue.push(&block);
+        }
+
+        thread = std::thread(&CSVReaderIOBuffAsync::readAhead, this);
+        fillBuffer();
+    }
+
+    // Dijalankan di thread pembaca
+    void readAhead()
+    {
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(signalMutex);
+                freeSignal.wait(lock, [this]()
+                                { return stopping || !freeQueue.empty(); });
+            }
+
+            if (stopping)
+                break;
+
+            Block *block = freeQueue.pop();
+            stream.read(block->data.data(), bufferSize);
+            size_t size = stream.gcount();
+            block->size = size;
+            {
+                // Push di dalam lock agar parser yang sedang memeriksa queue tidak melewatkan sinyal
+                std::lock_guard<std::mutex> lock(signalMutex);
+                filledQueue.push(std::move(block));
+            }
+            filledSignal.notify_one();
+
+            // Buffer kosong menandakan akhir file
+            if (size == 0)
+                break;
+        }
+    }
+
+    void fillBuffer()
+    {
+        if (current != nullptr)
+        {
+            bufferOffset += current->size;
+            {
+                std::lock_guard<std::mutex> lock(signalMutex);
+                freeQueue.push(std::move(current));
+            }
+            freeSignal.notify_one();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(signalMutex);
+            filledSignal.wait(lock, [this]()
+                              { return !filledQueue.empty(); });
+        }
+
+        current = filledQueue.pop();
+        bufferIndex = 0;
+
+        if (current->size == 0)
+            isEOf = true;
+    }
+
+    char get()
+    {
+        if (isEOf || bufferIndex == current->size)
+        {
+            isEOf = true;
+            return std::char_traits<char>::eof();
+        }
+        return current->data[bufferIndex];
+    }
+
+    void next()
+    {
+        bufferIndex++;
+        if (bufferIndex == current->size)
+        {
+            fillBuffer();
+        }
+    }
+
+    char *peekSpan(size_t &size)
+    {
+        size = isEOf ? 0 : current->size - bufferIndex;
+        return current->data.data() + bufferIndex;
+    }
+
+    void skip(size_t size)
+    {
+        bufferIndex += size;
+        if (bufferIndex == current->size)
+        {
+            fillBuffer();
+        }
+    }
+
     bool eof()
     {
         return isEOf;
     }
+
+    size_t offset()
+    {
+        return bufferOffset + bufferIndex;
+    }
 };
 
 struct CSVReaderIOSync
 {
+    static constexpr bool isMapped = false;
+
     std::ifstream stream;
+    // Dihitung sendiri karena tellg tidak bisa digunakan setelah akhir file
+    size_t position = 0;
 
     void open(const std::string &filename)
     {
@@ -92,13 +316,405 @@ struct CSVReaderIOSync
 
     void next()
     {
-        stream.get();
+        if (stream.get() != std::char_traits<char>::eof())
+            position++;
+    }
+
+    // Tidak mempunyai buffer sehingga pemindaian dilakukan per karakter
+    char *peekSpan(size_t &size)
+    {
+        size = 0;
+        return nullptr;
+    }
+
+    void skip(size_t size)
+    {
+        stream.ignore(size);
+        position += size;
     }
 
     bool eof()
     {
         return stream.eof();
     }
+
+    size_t offset()
+    {
+        return position;
+    }
+};
+
+/**
+ * IO yang membaca dari rentang memori [begin, end)
+ * Memori tidak dimiliki oleh IO ini
+ * Digunakan oleh CSVReaderIOMapped dan pembacaan paralel untuk membaca bagian dari file yang sudah dipetakan
+ */
+struct CSVReaderIOMemory
+{
+    static constexpr bool isMapped = true;
+
+    char *begin = nullptr;
+    char *cursor = nullptr;
+    char *end = nullptr;
+
+    char get()
+    {
+        if (cursor == end)
+            return std::char_traits<char>::eof();
+        return *cursor;
+    }
+
+    void next()
+    {
+        if (cursor != end)
+            cursor++;
+    }
+
+    char *peekSpan(size_t &size)
+    {
+        size = end - cursor;
+        return cursor;
+    }
+
+    void skip(size_t size)
+    {
+        cursor += size;
+    }
+
+    bool eof()
+    {
+        return cursor == end;
+    }
+};
+
+/**
+ * IO yang memetakan seluruh file ke memori (memory-mapped file)
+ * CSVReader dengan IO ini mengembalikan StringView yang menunjuk langsung ke isi file
+ * sehingga sel tidak perlu disalin ke dataBuffer
+ * Hanya sel yang mengandung escape (\, "", atau \r di tengah) yang disalin ke dataBuffer
+ */
+#ifdef _WIN32
+struct CSVReaderIOMapped : CSVReaderIOMemory
+{
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = NULL;
+
+    CSVReaderIOMapped()
+    {
+    }
+
+    // Handle dan mapping hanya boleh ditutup sekali
+    CSVReaderIOMapped(const CSVReaderIOMapped &) = delete;
+    CSVReaderIOMapped &operator=(const CSVReaderIOMapped &) = delete;
+
+    ~CSVReaderIOMapped()
+    {
+        close();
+    }
+
+    void open(const std::string &filename)
+    {
+        file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+        if (file == INVALID_HANDLE_VALUE)
+            throw std::domain_error("File not found");
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+            throw Winapi::Error("GetFileSizeEx fail");
+
+        // File kosong tidak bisa dipetakan
+        if (fileSize.QuadPart == 0)
+            return;
+
+        mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapping == NULL)
+            throw Winapi::Error("CreateFileMapping fail");
+
+        begin = static_cast<char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (begin == nullptr)
+            throw Winapi::Error("MapViewOfFile fail");
+
+        cursor = begin;
+        end = begin + fileSize.QuadPart;
+    }
+
+    void close()
+    {
+        if (begin != nullptr)
+            UnmapViewOfFile(begin);
+        if (mapping != NULL)
+            CloseHandle(mapping);
+        if (file != INVALID_HANDLE_VALUE)
+            CloseHandle(file);
+
+        begin = cursor = end = nullptr;
+        mapping = NULL;
+        file = INVALID_HANDLE_VALUE;
+    }
+};
+#else
+// Versi POSIX (mmap), digunakan oleh benchmark di Linux
+struct CSVReaderIOMapped : CSVReaderIOMemory
+{
+    int file = -1;
+    size_t mappedSize = 0;
+
+    CSVReaderIOMapped()
+    {
+    }
+
+    // Handle dan mapping hanya boleh ditutup sekali
+    CSVReaderIOMapped(const CSVReaderIOMapped &) = delete;
+    CSVReaderIOMapped &operator=(const CSVReaderIOMapped &) = delete;
+
+    ~CSVReaderIOMapped()
+    {
+        close();
+    }
+
+    void open(const std::string &filename)
+    {
+        file = ::open(filename.c_str(), O_RDONLY);
+
+        if (file < 0)
+            throw std::domain_error("File not found");
+
+        struct stat status;
+        if (fstat(file, &status) != 0)
+            throw std::runtime_error("fstat fail");
+
+        // File kosong tidak bisa dipetakan
+        if (status.st_size == 0)
+            return;
+
+        void *mapped = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (mapped == MAP_FAILED)
+            throw std::runtime_error("mmap fail");
+
+        madvise(mapped, status.st_size, MADV_SEQUENTIAL);
+
+        mappedSize = status.st_size;
+        begin = static_cast<char *>(mapped);
+        cursor = begin;
+        end = begin + mappedSize;
+    }
+
+    void close()
+    {
+        if (begin != nullptr)
+            munmap(begin, mappedSize);
+        if (file >= 0)
+            ::close(file);
+
+        begin = cursor = end = nullptr;
+        mappedSize = 0;
+        file = -1;
+    }
+};
+#endif
+
+/**
+ * Hasil pembacaan sel atau baris, digunakan di dalam parser sebagai pengganti exception
+ * Pada mode strict status selain Ok dilempar sebagai exception dengan pesan yang sama
+ */
+enum class CSVStatus
+{
+    Ok,
+    IllegalCharacterAfterQuote,
+    EscapeAtEndOfFile,
+    QuoteInUnquotedField,
+    QuoteNotClosed,
+    CellTooLarge,
+    TooManyCells,
+    TooFewCells,
+    InvalidField,
+};
+
+/**
+ * Baris yang dilewati pada mode lenient
+ * line adalah nomor baris fisik di file (header adalah baris 1), offset adalah posisi byte awal baris
+ */
+struct CSVQuarantinedRow
+{
+    size_t line;
+    size_t offset;
+    CSVStatus status;
+    std::string message;
+};
+
+/**
+ * Kesalahan format nilai pada satu sel
+ * row adalah nomor baris data (mulai dari 1, tidak termasuk header), 0 jika belum diketahui
+ * column adalah indeks kolom, columnName adalah nama kolom dari header
+ */
+struct CSVFieldError : std::domain_error
+{
+    size_t row;
+    size_t column;
+    std::string columnName;
+    std::string reason;
+
+    CSVFieldError(size_t row, size_t column, const std::string &columnName, const std::string &reason)
+        : std::domain_error(message(row, column, columnName, reason))
+    {
+        this->row = row;
+        this->column = column;
+        this->columnName = columnName;
+        this->reason = reason;
+    }
+
+    // Kesalahan yang sama dengan nomor baris dan nama kolom yang sudah diketahui
+    CSVFieldError at(size_t row, const std::string &columnName) const
+    {
+        return CSVFieldError(row, column, columnName, reason);
+    }
+
+    static std::string message(size_t row, size_t column, const std::string &columnName, const std::string &reason)
+    {
+        std::string result = reason + " at column " + std::to_string(column);
+        if (!columnName.empty())
+            result += " (" + columnName + ")";
+        if (row > 0)
+            result += " row " + std::to_string(row);
+        return result;
+    }
+};
+
+/**
+ * Konversi sel langsung dari StringView tanpa membuat wstring
+ * Dipanggil di dalam parse pada readParallel, jika gagal melempar CSVFieldError
+ * Nomor baris dan nama kolom diisi oleh CSVReader
+ */
+struct CSVField
+{
+    static int toInt(const std::vector<Utils::StringView> &data, size_t column)
+    {
+        int result;
+        if (!Utils::parseInt(data[column], result))
+            throw CSVFieldError(0, column, "", "Invalid integer");
+        return result;
+    }
+
+    static SYSTEMTIME toDate(const std::vector<Utils::StringView> &data, size_t column)
+    {
+        SYSTEMTIME result;
+        if (!Utils::parseDate(data[column], result))
+            throw CSVFieldError(0, column, "", "Invalid date");
+        return result;
+    }
+
+    template <typename E, typename S, size_t N>
+    static E toEnum(const std::vector<Utils::StringView> &data, size_t column, const S (&names)[N])
+    {
+        E result;
+        if (!Utils::parseEnum(data[column], names, N, result))
+            throw CSVFieldError(0, column, "", "Invalid enum value");
+        return result;
+    }
+};
+
+/**
+ * Posisi terakhir pembacaan file CSV, digunakan untuk membaca hanya baris yang ditambahkan di akhir file
+ * offset adalah posisi byte setelah baris terakhir yang sudah dibaca
+ * headerChecksum dan tailChecksum (checksum sCSVReaderCheckpointWindow byte sebelum offset)
+ * digunakan untuk mendeteksi file yang ditulis ulang
+ */
+struct CSVReaderCheckpoint
+{
+    std::vector<std::string> header;
+    uint64_t headerSize = 0;
+    uint64_t offset = 0;
+    uint64_t headerChecksum = 0;
+    uint64_t tailChecksum = 0;
+    // Nomor baris fisik di file pada offset
+    uint64_t line = 1;
+
+    bool valid() const
+    {
+        return offset > 0;
+    }
+};
+
+constexpr size_t sCSVReaderCheckpointWindow = 64 * 1024;
+
+inline uint64_t CSVReaderChecksum(const char *data, size_t size)
+{
+    const uint64_t key = 0x3c5a9e0d71b2f486;
+    return HalfSipHash_64(data, size, &key);
+}
+
+/**
+ * Satu kolom pada CSVBatch, offsets[row] dan lengths[row] menunjuk ke isi sel di arena
+ */
+struct CSVBatchColumn
+{
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> lengths;
+};
+
+/**
+ * Blok berisi beberapa baris dalam format kolom, diisi oleh CSVReader::readBatch
+ * Isi seluruh sel disalin berurutan ke satu arena, setiap kolom menyimpan offset dan panjang sel
+ * Blok bisa dipakai ulang untuk readBatch berikutnya tanpa alokasi ulang
+ */
+struct CSVBatch
+{
+    std::vector<char> arena;
+    std::vector<CSVBatchColumn> columns;
+    size_t rowCount = 0;
+
+    void reset(size_t columnCount, size_t maxRows)
+    {
+        arena.clear();
+        columns.resize(columnCount);
+        for (CSVBatchColumn &column : columns)
+        {
+            column.offsets.clear();
+            column.lengths.clear();
+            column.offsets.reserve(maxRows);
+            column.lengths.reserve(maxRows);
+        }
+        rowCount = 0;
+    }
+
+    void append(size_t column, const Utils::StringView &view)
+    {
+        if (arena.size() + view.size > UINT32_MAX)
+            throw std::domain_error("Batch arena exceed 4GB");
+
+        columns[column].offsets.push_back(static_cast<uint32_t>(arena.size()));
+        columns[column].lengths.push_back(static_cast<uint32_t>(view.size));
+        arena.insert(arena.end(), view.begin, view.begin + view.size);
+    }
+
+    // StringView tidak berlaku lagi setelah readBatch berikutnya
+    Utils::StringView cell(size_t row, size_t column)
+    {
+        const CSVBatchColumn &c = columns[column];
+        return Utils::StringView(arena.data() + c.offsets[row], c.lengths[row]);
+    }
+};
+
+/**
+ * Bagian file yang dibaca oleh satu thread pada pembacaan paralel
+ * begin adalah awal baris pertama, end adalah batas nominal bagian
+ * Baris terakhir boleh melewati end, stop adalah posisi setelah baris terakhir
+ */
+template <typename R>
+struct CSVReaderChunk
+{
+    char *begin = nullptr;
+    char *end = nullptr;
+    char *stop = nullptr;
+    std::vector<R> rows;
+    // Baris yang dilewati pada mode lenient, nomor baris dihitung dari awal bagian (0)
+    std::vector<CSVQuarantinedRow> quarantine;
+    // Jumlah baris fisik yang dibaca sampai stop
+    size_t lines = 0;
+    // readData mengembalikan false (baris kosong) sebelum bagian selesai dibaca
+    bool finished = false;
+    std::exception_ptr error;
 };
 
 template <typename IO>
@@ -107,8 +723,28 @@ struct CSVReader
     std::vector<std::string> header;
     std::vector<std::vector<char>> dataBuffer;
     std::vector<Utils::StringView> data;
+    // Kolom yang dicari dengan findHeaderIndex
+    std::vector<bool> projected;
+    // Jika true, kolom yang tidak pernah dicari dengan findHeaderIndex dilewati tanpa disalin
+    // dan isinya di data selalu kosong
+    bool projection = false;
+    // Jumlah baris data yang sudah dibaca
+    size_t rowCount = 0;
+    // Ukuran header dalam byte, hanya diisi untuk IO yang memetakan file ke memori
+    size_t headerSize = 0;
+    // Jika true, baris yang formatnya salah dicatat di quarantine dan dilewati, bukan dilempar sebagai exception
+    bool lenient = false;
+    std::vector<CSVQuarantinedRow> quarantine;
+    // Nomor baris fisik di file pada posisi pembacaan sekarang (header adalah baris 1)
+    size_t line = 1;
+    // Nomor baris dan posisi byte dari baris terakhir yang berhasil dibaca readData
+    size_t lastRowLine = 0;
+    size_t lastRowOffset = 0;
+    // Karakter setelah quote penutup untuk pesan CSVStatus::IllegalCharacterAfterQuote
+    char illegalChar = 0;
     std::string filename;
     IO io;
+    CSVScanner scanner;
 
     char separator;
 
@@ -118,6 +754,7 @@ struct CSVReader
     {
         this->filename = filename;
         this->separator = separator;
+        scanner = CSVScanner(separator);
     }
 
     void startRead()
@@ -136,11 +773,109 @@ struct CSVReader
             io.next();
 
             if (ch == '\n')
+            {
+                line++;
                 break;
+            }
         }
 
-        dataBuffer = std::vector<std::vector<char>>(header.size(), std::vector<char>(defaultBufferSize));
+        headerSize = position(std::integral_constant<bool, IO::isMapped>());
+        resizeColumns();
+    }
+
+    void resizeColumns()
+    {
+        // Buffer tiap kolom baru dialokasikan saat pertama kali dibutuhkan
+        dataBuffer.resize(header.size());
         data.resize(header.size());
+        projected.resize(header.size());
+    }
+
+    size_t position(std::false_type)
+    {
+        return 0;
+    }
+
+    size_t position(std::true_type)
+    {
+        return io.cursor - io.begin;
+    }
+
+    // Posisi byte pembacaan sekarang di file
+    size_t offset(std::false_type)
+    {
+        return io.offset();
+    }
+
+    size_t offset(std::true_type)
+    {
+        return io.cursor - io.begin;
+    }
+
+    /**
+     * Menyimpan posisi pembacaan sekarang, hanya untuk IO yang memetakan file ke memori
+     * Dipanggil setelah seluruh data dibaca (readData mengembalikan false atau setelah readParallel)
+     */
+    CSVReaderCheckpoint checkpoint()
+    {
+        static_assert(IO::isMapped, "checkpoint need memory mapped IO");
+
+        CSVReaderCheckpoint result;
+        result.header = header;
+        result.headerSize = headerSize;
+        result.offset = io.cursor - io.begin;
+        result.headerChecksum = CSVReaderChecksum(io.begin, headerSize);
+        result.line = line;
+
+        size_t windowBegin = std::max<size_t>(headerSize, result.offset - std::min<size_t>(result.offset, sCSVReaderCheckpointWindow));
+        result.tailChecksum = CSVReaderChecksum(io.begin + windowBegin, result.offset - windowBegin);
+        return result;
+    }
+
+    /**
+     * Membuka file dan melanjutkan pembacaan dari checkpoint tanpa membaca ulang header dan data sebelumnya
+     * Digunakan sebagai pengganti startRead
+     *
+     * Mengembalikan false jika file lebih kecil dari checkpoint (dipotong) atau isi sebelum checkpoint berubah (ditulis ulang),
+     * file tersebut harus dibaca ulang dari awal
+     * Baris terakhir yang belum diakhiri \n tidak dibaca karena mungkin masih ditulis,
+     * baris tersebut dibaca pada resume berikutnya
+     */
+    bool resume(const CSVReaderCheckpoint &checkpoint)
+    {
+        static_assert(IO::isMapped, "resume need memory mapped IO");
+
+        io.open(filename);
+        size_t size = io.end - io.begin;
+
+        if (!checkpoint.valid() || size < checkpoint.offset || checkpoint.offset < checkpoint.headerSize)
+            return false;
+
+        // Data baru hanya bisa ditambahkan setelah baris yang lengkap
+        if (size > checkpoint.offset && io.begin[checkpoint.offset - 1] != '\n')
+            return false;
+
+        if (CSVReaderChecksum(io.begin, checkpoint.headerSize) != checkpoint.headerChecksum)
+            return false;
+
+        size_t windowBegin = std::max<size_t>(checkpoint.headerSize, checkpoint.offset - std::min<size_t>(checkpoint.offset, sCSVReaderCheckpointWindow));
+        if (CSVReaderChecksum(io.begin + windowBegin, checkpoint.offset - windowBegin) != checkpoint.tailChecksum)
+            return false;
+
+        header = checkpoint.header;
+        headerSize = checkpoint.headerSize;
+        rowCount = 0;
+        line = checkpoint.line;
+        resizeColumns();
+
+        io.cursor = io.begin + checkpoint.offset;
+
+        char *lastNewLine = io.end;
+        while (lastNewLine != io.cursor && lastNewLine[-1] != '\n')
+            lastNewLine--;
+        io.end = lastNewLine;
+
+        return true;
     }
 
     int findHeaderIndex(const std::string &name)
@@ -150,56 +885,495 @@ struct CSVReader
         if (it == header.end())
             return -1;
 
+        projected[it - header.begin()] = true;
         return it - header.begin();
     }
 
+    /**
+     * Membaca satu baris ke data
+     * Mengembalikan false jika data sudah habis atau bertemu baris kosong
+     *
+     * Pada mode strict (lenient bernilai false), baris yang formatnya salah dilempar sebagai exception
+     * Pada mode lenient, baris tersebut dicatat di quarantine lalu pembacaan dilanjutkan dari baris berikutnya
+     */
     bool readData()
+    {
+        while (true)
+        {
+            size_t rowOffset = offset(std::integral_constant<bool, IO::isMapped>());
+            size_t rowLine = line;
+            size_t cellCount;
+            CSVStatus status = readRow(cellCount);
+
+            if (status == CSVStatus::Ok)
+            {
+                if (cellCount == 0)
+                    return false;
+
+                rowCount++;
+                lastRowOffset = rowOffset;
+                lastRowLine = rowLine;
+                return true;
+            }
+
+            if (!lenient)
+                throwStatus(status, cellCount);
+
+            quarantine.push_back(CSVQuarantinedRow{rowLine, rowOffset, status, statusMessage(status, cellCount)});
+            resync(status, rowOffset, rowLine, std::integral_constant<bool, IO::isMapped>());
+        }
+    }
+
+    /**
+     * Membaca sel dari satu baris ke data, cellCount berisi jumlah sel yang dibaca
+     * cellCount bernilai 0 jika data sudah habis atau baris kosong
+     */
+    CSVStatus readRow(size_t &cellCount)
     {
         size_t i = 0;
-        size_t filledSize;
+        bool firstCellEmpty = false;
+        cellCount = 0;
 
         while (!io.eof())
         {
             if (i >= header.size())
-                throw std::domain_error("Data length exceed header length");
+            {
+                cellCount = i;
+                return CSVStatus::TooManyCells;
+            }
+
+            size_t cellSize;
+            CSVStatus status;
+            if (projection && !projected[i])
+                status = skipCellData(i, cellSize, std::integral_constant<bool, IO::isMapped>());
+            else
+                status = readCellData(i, cellSize, std::integral_constant<bool, IO::isMapped>());
+
+            if (status != CSVStatus::Ok)
+            {
+                cellCount = i;
+                return status;
+            }
 
-            readCell(dataBuffer[i], filledSize);
-            data[i] = Utils::StringView(dataBuffer[i].data(), filledSize);
+            if (i == 0)
+                firstCellEmpty = cellSize == 0;
             i++;
 
             char ch = io.get();
             io.next();
 
             if (ch == '\n')
+            {
+                line++;
                 break;
+            }
         }
 
-        if (i == 0 || (i == 1 && data[0].size == 0))
-            return false;
+        if (i == 0 || (i == 1 && firstCellEmpty))
+            return CSVStatus::Ok;
 
+        cellCount = i;
         if (i < data.size())
-            throw std::domain_error("Data size below header size " + std::to_string(i));
+            return CSVStatus::TooFewCells;
+
+        return CSVStatus::Ok;
+    }
+
+    /**
+     * Melanjutkan pembacaan dari baris setelah baris yang dikarantina
+     * Baris dengan sel kurang sudah dibaca sampai \n sehingga tidak perlu dilewati
+     * Quote yang tidak ditutup membaca sampai akhir file, untuk IO yang memetakan file ke memori
+     * pembacaan diulang dari \n pertama setelah awal baris tersebut
+     * sedangkan untuk IO lain sisa file tidak bisa dibaca ulang
+     */
+    void resync(CSVStatus status, size_t rowOffset, size_t rowLine, std::true_type)
+    {
+        if (status == CSVStatus::QuoteNotClosed)
+        {
+            io.cursor = io.begin + rowOffset;
+            line = rowLine;
+        }
+        resync(status, rowOffset, rowLine, std::false_type());
+    }
+
+    void resync(CSVStatus status, size_t, size_t, std::false_type)
+    {
+        if (status == CSVStatus::TooFewCells)
+            return;
+
+        while (!io.eof())
+        {
+            char ch = io.get();
+            io.next();
+
+            if (ch == '\n')
+            {
+                line++;
+                break;
+            }
+        }
+    }
+
+    /**
+     * Membaca maksimal maxRows baris ke batch dalam format kolom
+     * Indeks kolom sama dengan indeks header, sehingga bisa digunakan bersama findHeaderIndex
+     * Jika projection bernilai true, sel pada kolom yang tidak dicari selalu kosong
+     * Mengembalikan jumlah baris yang dibaca, 0 jika data sudah habis
+     */
+    size_t readBatch(CSVBatch &batch, size_t maxRows)
+    {
+        batch.reset(header.size(), maxRows);
+
+        while (batch.rowCount < maxRows && readData())
+        {
+            for (size_t i = 0; i < data.size(); i++)
+                batch.append(i, data[i]);
+            batch.rowCount++;
+        }
+
+        return batch.rowCount;
+    }
+
+    /**
+     * Membaca seluruh data secara paralel, hanya untuk IO yang memetakan file ke memori
+     * startRead harus dipanggil terlebih dahulu
+     *
+     * File dibagi menjadi beberapa bagian, setiap bagian dibaca oleh satu thread
+     * Awal bagian digeser ke setelah \n berikutnya. Karena \n tersebut bisa berada di dalam quote,
+     * awal bagian divalidasi dengan posisi akhir bagian sebelumnya. Jika berbeda, bagian tersebut dibaca ulang
+     * dari posisi yang benar sehingga hasilnya selalu sama dengan pembacaan berurutan
+     *
+     * parse dipanggil di thread pekerja untuk mengubah baris (data) menjadi R, dengan signature R parse(const std::vector<Utils::StringView> &data)
+     * consume dipanggil di thread pemanggil sesuai urutan baris di file, dengan signature void consume(R &&row)
+     * Exception dari parse atau dari format CSV dilempar ulang di thread pemanggil setelah baris sebelumnya di-consume
+     * CSVFieldError dari parse dilempar ulang dengan nomor baris di file dan nama kolom
+     * Pada mode lenient, baris dengan CSVFieldError dicatat di quarantine bersama baris yang formatnya salah
+     */
+    template <typename R, typename Parse, typename Consume>
+    void readParallel(size_t threadCount, Parse parse, Consume consume)
+    {
+        static_assert(IO::isMapped, "readParallel need memory mapped IO");
+
+        const size_t minChunkSize = 256 * 1024;
+        size_t size = io.end - io.cursor;
+        size_t chunkCount = std::max<size_t>(1, std::min(threadCount, size / minChunkSize));
+
+        std::vector<CSVReaderChunk<R>> chunks(chunkCount);
+        for (size_t i = 0; i < chunkCount; i++)
+        {
+            chunks[i].begin = io.cursor + size * i / chunkCount;
+            chunks[i].end = io.cursor + size * (i + 1) / chunkCount;
+
+            // Geser ke awal baris
+            if (i > 0)
+            {
+                char *newLine = std::find(chunks[i].begin - 1, io.end, '\n');
+                chunks[i].begin = newLine == io.end ? io.end : newLine + 1;
+            }
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(chunkCount);
+
+        try
+        {
+            // Thread dibuat di dalam try agar thread yang sudah berjalan tetap di-join jika pembuatan thread gagal
+            for (size_t i = 1; i < chunkCount; i++)
+            {
+                threads.push_back(std::thread([&, i]()
+                                              { readChunk(chunks[i], parse); }));
+            }
+
+            readChunk(chunks[0], parse);
+            char *expectedBegin = chunks[0].begin;
+
+            for (size_t i = 0; i < chunkCount; i++)
+            {
+                CSVReaderChunk<R> &chunk = chunks[i];
+                if (i > 0)
+                    threads[i - 1].join();
+
+                if (chunk.begin != expectedBegin)
+                {
+                    chunk.begin = expectedBegin;
+                    chunk.rows.clear();
+                    chunk.quarantine.clear();
+                    chunk.finished = false;
+                    chunk.error = nullptr;
+                    readChunk(chunk, parse);
+                }
+
+                size_t rowsBefore = rowCount;
+                for (R &row : chunk.rows)
+                    consume(std::move(row));
+                rowCount += chunk.rows.size();
+                std::vector<R>().swap(chunk.rows);
+
+                for (CSVQuarantinedRow &row : chunk.quarantine)
+                {
+                    row.line += line;
+                    quarantine.push_back(std::move(row));
+                }
+                line += chunk.lines;
+
+                if (chunk.error)
+                {
+                    try
+                    {
+                        std::rethrow_exception(chunk.error);
+                    }
+                    catch (const CSVFieldError &e)
+                    {
+                        // Nomor baris dari readChunk dihitung dari awal bagian
+                        throw e.at(rowsBefore + e.row, e.columnName);
+                    }
+                }
+
+                if (chunk.finished)
+                    break;
+
+                expectedBegin = chunk.stop;
+            }
+        }
+        catch (...)
+        {
+            for (std::thread &thread : threads)
+            {
+                if (thread.joinable())
+                    thread.join();
+            }
+            throw;
+        }
+
+        for (std::thread &thread : threads)
+        {
+            if (thread.joinable())
+                thread.join();
+        }
+
+        io.cursor = io.end;
+    }
+
+    template <typename R, typename Parse>
+    void readChunk(CSVReaderChunk<R> &chunk, Parse &parse)
+    {
+        CSVReader<CSVReaderIOMemory> reader(filename, separator);
+        reader.header = header;
+        reader.dataBuffer.resize(header.size());
+        reader.data.resize(header.size());
+        reader.projected = projected;
+        reader.projection = projection;
+        reader.lenient = lenient;
+        reader.line = 0;
+        // begin tetap awal file agar offset baris sama dengan pembacaan berurutan
+        reader.io.begin = io.begin;
+        reader.io.cursor = chunk.begin;
+        reader.io.end = io.end;
+
+        try
+        {
+            while (reader.io.cursor < chunk.end)
+            {
+                if (!reader.readData())
+                {
+                    chunk.finished = true;
+                    break;
+                }
+
+                if (!lenient)
+                {
+                    chunk.rows.push_back(parse(reader.data));
+                    continue;
+                }
+
+                try
+                {
+                    chunk.rows.push_back(parse(reader.data));
+                }
+                catch (const CSVFieldError &e)
+                {
+                    const std::string &columnName = e.column < header.size() ? header[e.column] : e.columnName;
+                    reader.quarantine.push_back(CSVQuarantinedRow{reader.lastRowLine, reader.lastRowOffset, CSVStatus::InvalidField, e.at(0, columnName).what()});
+                }
+            }
+        }
+        catch (const CSVFieldError &e)
+        {
+            const std::string &columnName = e.column < header.size() ? header[e.column] : e.columnName;
+            chunk.error = std::make_exception_ptr(e.at(reader.rowCount, columnName));
+        }
+        catch (...)
+        {
+            chunk.error = std::current_exception();
+        }
+
+        chunk.stop = reader.io.cursor;
+        chunk.lines = reader.line;
+        chunk.quarantine = std::move(reader.quarantine);
+    }
+
+    CSVStatus readCellData(size_t i, size_t &size, std::false_type)
+    {
+        if (dataBuffer[i].empty())
+            dataBuffer[i].resize(defaultBufferSize);
+
+        CSVStatus status = scanCell<true>(&dataBuffer[i], size);
+        data[i] = Utils::StringView(dataBuffer[i].data(), size);
+        return status;
+    }
+
+    CSVStatus readCellData(size_t i, size_t &size, std::true_type)
+    {
+        if (!readCellView(i))
+            return readCellData(i, size, std::false_type());
+        size = data[i].size;
+        return CSVStatus::Ok;
+    }
+
+    CSVStatus skipCellData(size_t i, size_t &size, std::false_type)
+    {
+        data[i] = Utils::StringView();
+        return scanCell<false>(nullptr, size);
+    }
 
+    CSVStatus skipCellData(size_t i, size_t &size, std::true_type)
+    {
+        CSVStatus status = CSVStatus::Ok;
+        if (readCellView(i))
+            size = data[i].size;
+        else
+            status = scanCell<false>(nullptr, size);
+
+        data[i] = Utils::StringView();
+        return status;
+    }
+
+    /**
+     * Membaca sel tanpa menyalin untuk IO yang memetakan file ke memori
+     * Sel tanpa escape langsung menunjuk ke isi file (tanpa tanda petik jika diapit petik)
+     * Mengembalikan false jika sel butuh escape, sel tersebut harus dibaca ulang dengan readCell
+     */
+    bool readCellView(size_t i)
+    {
+        char *p = io.cursor;
+        char *end = io.end;
+
+        if (p == end || *p == separator || *p == '\n')
+        {
+            data[i] = Utils::StringView(p, 0);
+            return true;
+        }
+
+        char *cellBegin;
+        char *cellEnd;
+
+        size_t newLines = 0;
+
+        if (*p == '"')
+        {
+            cellBegin = ++p;
+            while (true)
+            {
+                p += scanner.find(p, end - p);
+
+                // Pemisah dan baris baru di dalam quote adalah bagian dari sel
+                if (p == end || (*p != separator && *p != '\n'))
+                    break;
+                if (*p == '\n')
+                    newLines++;
+                p++;
+            }
+
+            // Quote tidak ditutup atau butuh escape
+            if (p == end || *p != '"' || (p + 1 != end && p[1] == '"'))
+                return false;
+
+            cellEnd = p++;
+            while (p != end && *p == '\r')
+                p++;
+
+            if (p != end && *p != separator && *p != '\n')
+                return false;
+        }
+        else
+        {
+            // Karakter pertama selalu disalin apa adanya oleh readCell
+            cellBegin = p++;
+            p += scanner.find(p, end - p);
+
+            cellEnd = p;
+            while (p != end && *p == '\r')
+                p++;
+
+            if (p != end && *p != separator && *p != '\n')
+                return false;
+        }
+
+        data[i] = Utils::StringView(cellBegin, cellEnd - cellBegin);
+        io.cursor = p;
+        line += newLines;
         return true;
     }
 
     void readCell(std::vector<char> &buffer, size_t &size)
+    {
+        CSVStatus status = scanCell<true>(&buffer, size);
+        if (status != CSVStatus::Ok)
+            throwStatus(status, 0);
+    }
+
+    /**
+     * Membaca satu sel
+     * Jika Copy bernilai false, isi sel hanya dilewati tanpa disalin dan buffer tidak digunakan
+     * size tetap berisi ukuran sel
+     * Kesalahan format dikembalikan sebagai status, tidak dilempar
+     */
+    template <bool Copy>
+    CSVStatus scanCell(std::vector<char> *buffer, size_t &size)
     {
         size = 0;
         char ch = io.get();
         if (ch == std::char_traits<char>::eof() || ch == separator || ch == '\n')
-            return;
+            return CSVStatus::Ok;
 
         io.next();
 
         bool startWithQuote = ch == '"';
         bool insideQuote = startWithQuote;
 
-        if (!insideQuote)
-            buffer.at(size++) = ch;
+        if (!insideQuote && !appendCell<Copy>(buffer, size, ch))
+            return CSVStatus::CellTooLarge;
 
-        while (io.get() != std::char_traits<char>::eof())
+        while (true)
         {
+            // Salin karakter biasa sampai karakter struktural berikutnya sekaligus
+            size_t available;
+            char *span = io.peekSpan(available);
+            size_t run = available > 0 ? scanner.find(span, available) : 0;
+
+            if (run > 0)
+            {
+                if (startWithQuote && !insideQuote)
+                {
+                    illegalChar = span[0];
+                    return CSVStatus::IllegalCharacterAfterQuote;
+                }
+
+                if (Copy)
+                {
+                    if (size + run > buffer->size())
+                        return CSVStatus::CellTooLarge;
+
+                    std::copy(span, span + run, buffer->begin() + size);
+                }
+                size += run;
+                io.skip(run);
+                continue;
+            }
+
+            if (io.get() == std::char_traits<char>::eof())
+                break;
+
             if (!insideQuote && (io.get() == separator || io.get() == '\n'))
                 break;
 
@@ -210,7 +1384,10 @@ struct CSVReader
                 continue;
 
             if (startWithQuote && !insideQuote)
-                throw std::domain_error("Illegal character after double quote " + std::string{ch});
+            {
+                illegalChar = ch;
+                return CSVStatus::IllegalCharacterAfterQuote;
+            }
 
             if (ch == '\\')
             {
@@ -218,31 +1395,87 @@ struct CSVReader
                 io.next();
 
                 if (ch == std::char_traits<char>::eof())
-                    throw std::domain_error("Espacing in end of file is illegal");
+                    return CSVStatus::EscapeAtEndOfFile;
 
-                buffer.at(size++) = ch;
+                if (!appendCell<Copy>(buffer, size, ch))
+                    return CSVStatus::CellTooLarge;
             }
             else if (ch == '"')
             {
                 if (!insideQuote)
-                    throw std::domain_error("Field not enclosed with double quoted cannot have double qoute");
+                    return CSVStatus::QuoteInUnquotedField;
 
                 if (!io.eof() && io.get() == '"')
                 {
                     ch = io.get();
                     io.next();
-                    buffer.at(size++) = ch;
+                    if (!appendCell<Copy>(buffer, size, ch))
+                        return CSVStatus::CellTooLarge;
                 }
                 else
                 {
                     insideQuote = false;
                 }
             }
-            else
-                buffer.at(size++) = ch;
+            else if (!appendCell<Copy>(buffer, size, ch))
+                return CSVStatus::CellTooLarge;
         }
 
         if (startWithQuote && insideQuote)
-            throw std::domain_error("Quoted field not closed");
+            return CSVStatus::QuoteNotClosed;
+
+        return CSVStatus::Ok;
+    }
+
+    // Mengembalikan false jika buffer penuh
+    template <bool Copy>
+    bool appendCell(std::vector<char> *buffer, size_t &size, char ch)
+    {
+        // \n di dalam sel (di dalam quote atau di-escape) tetap dihitung sebagai baris di file
+        if (ch == '\n')
+            line++;
+
+        if (Copy)
+        {
+            if (size >= buffer->size())
+                return false;
+            (*buffer)[size] = ch;
+        }
+        size++;
+        return true;
+    }
+
+    /**
+     * Pesan kesalahan dari status, sama dengan pesan exception pada mode strict
+     * cellCount hanya digunakan untuk CSVStatus::TooFewCells
+     */
+    std::string statusMessage(CSVStatus status, size_t cellCount)
+    {
+        switch (status)
+        {
+        case CSVStatus::IllegalCharacterAfterQuote:
+            return "Illegal character after double quote " + std::string{illegalChar};
+        case CSVStatus::EscapeAtEndOfFile:
+            return "Espacing in end of file is illegal";
+        case CSVStatus::QuoteInUnquotedField:
+            return "Field not enclosed with double quoted cannot have double qoute";
+        case CSVStatus::QuoteNotClosed:
+            return "Quoted field not closed";
+        case CSVStatus::CellTooLarge:
+            return "Cell size exceed buffer size";
+        case CSVStatus::TooManyCells:
+            return "Data length exceed header length";
+        case CSVStatus::TooFewCells:
+            return "Data size below header size " + std::to_string(cellCount);
+        default:
+            return "";
+        }
+    }
+
+    void throwStatus(CSVStatus status, size_t cellCount)
+    {
+        if (status == CSVStatus::CellTooLarge)
+            throw std::out_of_range(statusMessage(status, cellCount));
+        throw std::domain_error(statusMessage(status, cellCount));
     }
 };
\ No newline at end of file
@@ -0,0 +1,261 @@
+/*
+    Benchmark pembacaan CSV dengan data dari Generate_RandomData
+    Dapat dijalankan di Windows maupun Linux tanpa jaringan
+
+    Penggunaan: CSVReader_Benchmark [folder data] [jumlah pengulangan]
+    Folder data default adalah data/generated, pengulangan default 1
+    Jika pengulangan lebih dari 1, waktu tercepat yang ditampilkan
+
+    Yang diukur untuk setiap file:
+    - readData dengan setiap IO (Sync, BuffSync, BuffAsync, Mapped)
+    - readBatch dan readParallel dengan CSVReaderIOMapped
+    Untuk products.csv juga diukur pemuatan lengkap seperti Kelontong (readParallel ke RBTree dan RobinHoodHashMap)
+*/
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+#include "CSVReader.hpp"
+#include "RBTree.hpp"
+#include "RobinHoodHashMap.hpp"
+#include "Dictionary.hpp"
+#include "HalfSipHash.h"
+#include "Timer.hpp"
+
+struct BenchmarkFile
+{
+    const char *name;
+    char separator;
+};
+
+const BenchmarkFile benchmarkFiles[] = {
+    {"products.csv", ';'},
+    {"books.csv", ';'},
+    {"Rumah_Sakit.csv", ','},
+    {"FestDataFiksBgt.csv", ';'},
+    {"ppdb.csv", ';'}};
+
+struct BenchmarkResult
+{
+    size_t rows;
+    double seconds;
+};
+
+// Sama dengan Product di Kelontong.cpp
+struct Product
+{
+    std::wstring sku;
+    std::wstring name;
+    DictionaryCode category;
+    std::wstring price;
+    std::string sortKey;
+};
+
+void UpdateSortKey(Product &product)
+{
+    product.sortKey = Utils::SortKey(product.name, product.sku);
+}
+
+struct ProductNameCompare
+{
+    int compare(const Product &a, const Product &b)
+    {
+        return Utils::CompareSortKey(a.sortKey, b.sortKey);
+    }
+};
+
+struct ProductNameHasher
+{
+    uint64_t seed = 0xe17a1465;
+
+    uint64_t hash(const std::wstring &wstr)
+    {
+        return HalfSipHash_64(wstr.data(), sizeof(wchar_t) * wstr.size(), &seed);
+    }
+};
+
+uint64_t FileSize(const std::string &path)
+{
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream)
+        return 0;
+    return static_cast<uint64_t>(stream.tellg());
+}
+
+template <typename Run>
+BenchmarkResult Measure(size_t repeat, Run run)
+{
+    BenchmarkResult best{0, 0};
+
+    for (size_t i = 0; i < repeat; i++)
+    {
+        Timer timer;
+        timer.start();
+        size_t rows = run();
+        timer.end();
+
+        double seconds = std::chrono::duration<double>(timer.duration).count();
+        if (i == 0 || seconds < best.seconds)
+            best = BenchmarkResult{rows, seconds};
+    }
+
+    return best;
+}
+
+void PrintResult(const char *file, const char *method, const BenchmarkResult &result, uint64_t bytes)
+{
+    double seconds = result.seconds > 0 ? result.seconds : 1e-9;
+    printf("%-20s %-28s %10zu baris %9.3f s %12.0f baris/s %9.1f MB/s\n",
+           file, method, result.rows, result.seconds, result.rows / seconds, bytes / seconds / (1024 * 1024));
+}
+
+template <typename IO>
+size_t ReadSequential(const std::string &path, char separator)
+{
+    CSVReader<IO> reader(path, separator);
+    reader.startRead();
+
+    size_t rows = 0;
+    while (reader.readData())
+        rows++;
+    return rows;
+}
+
+size_t ReadBatches(const std::string &path, char separator)
+{
+    CSVReader<CSVReaderIOMapped> reader(path, separator);
+    reader.startRead();
+
+    CSVBatch batch;
+    size_t rows = 0;
+    while (size_t count = reader.readBatch(batch, 4096))
+        rows += count;
+    return rows;
+}
+
+size_t ReadParallel(const std::string &path, char separator, size_t threadCount)
+{
+    CSVReader<CSVReaderIOMapped> reader(path, separator);
+    reader.startRead();
+
+    // parse menjumlahkan ukuran sel agar seluruh sel benar-benar dibaca
+    size_t rows = 0;
+    reader.readParallel<size_t>(
+        threadCount,
+        [](const std::vector<Utils::StringView> &data)
+        {
+            size_t size = 0;
+            for (const Utils::StringView &cell : data)
+                size += cell.size;
+            return size;
+        },
+        [&](size_t &&)
+        { rows++; });
+    return rows;
+}
+
+// Pemuatan lengkap seperti MainWindow::DoLoad di Kelontong.cpp
+size_t LoadProducts(const std::string &path, size_t threadCount)
+{
+    RBTree<Product, ProductNameCompare> tree;
+    RobinHoodHashMap<std::wstring, Product, ProductNameHasher> hashTable;
+    Dictionary categories;
+
+    CSVReader<CSVReaderIOMapped> reader(path, ';');
+    reader.startRead();
+    reader.projection = true;
+
+    int skuIndex = reader.findHeaderIndex("sku");
+    int nameIndex = reader.findHeaderIndex("name");
+    int categoryIndex = reader.findHeaderIndex("category");
+    int priceIndex = reader.findHeaderIndex("price");
+
+    struct ProductRow
+    {
+        Product product;
+        std::string category;
+    };
+
+    std::vector<Product> products;
+
+    reader.readParallel<ProductRow>(
+        threadCount,
+        [&](const std::vector<Utils::StringView> &data)
+        {
+            ProductRow row;
+            Utils::stringviewsToWstrings(data, {{skuIndex, &row.product.sku},
+                                                {nameIndex, &row.product.name},
+                                                {priceIndex, &row.product.price}});
+            row.category.assign(data[categoryIndex].begin, data[categoryIndex].size);
+            UpdateSortKey(row.product);
+            return row;
+        },
+        [&](ProductRow &&row)
+        {
+            row.product.category = categories.internUtf8(row.category);
+            hashTable.put(row.product.sku, row.product);
+            products.push_back(std::move(row.product));
+        });
+
+    tree.insertBulk(std::move(products));
+    return tree.count;
+}
+
+int main(int argc, char **argv)
+{
+    std::string directory = argc >= 2 ? argv[1] : "data/generated";
+    size_t repeat = argc >= 3 ? std::stoul(argv[2]) : 1;
+    size_t threadCount = std::max<unsigned>(1, std::thread::hardware_concurrency());
+
+    printf("Folder data: %s, pengulangan: %zu, thread: %zu\n", directory.c_str(), repeat, threadCount);
+
+    try
+    {
+        for (const BenchmarkFile &file : benchmarkFiles)
+        {
+            std::string path = directory + "/" + file.name;
+            uint64_t bytes = FileSize(path);
+            if (bytes == 0)
+            {
+                printf("%-20s tidak ditemukan, dilewati\n", file.name);
+                continue;
+            }
+
+            char separator = file.separator;
+            PrintResult(file.name, "readData IOSync", Measure(repeat, [&]()
+                                                              { return ReadSequential<CSVReaderIOSync>(path, separator); }),
+                        bytes);
+            PrintResult(file.name, "readData IOBuffSync", Measure(repeat, [&]()
+                                                                  { return ReadSequential<CSVReaderIOBuffSync>(path, separator); }),
+                        bytes);
+            PrintResult(file.name, "readData IOBuffAsync", Measure(repeat, [&]()
+                                                                   { return ReadSequential<CSVReaderIOBuffAsync>(path, separator); }),
+                        bytes);
+            PrintResult(file.name, "readData IOMapped", Measure(repeat, [&]()
+                                                                { return ReadSequential<CSVReaderIOMapped>(path, separator); }),
+                        bytes);
+            PrintResult(file.name, "readBatch IOMapped", Measure(repeat, [&]()
+                                                                 { return ReadBatches(path, separator); }),
+                        bytes);
+            PrintResult(file.name, "readParallel IOMapped", Measure(repeat, [&]()
+                                                                    { return ReadParallel(path, separator, threadCount); }),
+                        bytes);
+
+            if (std::string(file.name) == "products.csv")
+            {
+                PrintResult(file.name, "RBTree + RobinHoodHashMap", Measure(repeat, [&]()
+                                                                            { return LoadProducts(path, threadCount); }),
+                            bytes);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        printf("Error: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CSV_SCANNER_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define CSV_SCANNER_SSE2
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * Pemindai karakter struktural CSV
+ * Karakter struktural adalah pemisah, ", \, \r, dan \n
+ *
+ * Pemindaian dilakukan per blok (32 byte dengan AVX2, 16 byte dengan SSE2, 8 byte tanpa SIMD)
+ * Setiap blok menghasilkan bitmask, bit ke-i bernilai 1 jika byte ke-i adalah karakter struktural
+ * Posisi karakter struktural pertama didapatkan dengan menghitung jumlah bit 0 di belakang (count trailing zero)
+ * Byte yang tersisa di akhir yang tidak cukup untuk satu blok dipindai dengan tabel
+ *
+ * Pemindai hanya mencari karakter struktural berikutnya dari awal setiap sel, tidak membangun
+ * indeks bitmask seluruh blok yang dipakai ulang antar sel. Indeks seperti itu (bitmask per blok
+ * yang disimpan, maupun daftar posisi per 2 KB) sudah dicoba dan lebih lambat 15-40% pada data
+ * aplikasi: sel pendek sehingga blok pertama hampir selalu berisi pemisah berikutnya, dan
+ * memindai ulang satu blok lebih murah daripada percabangan dan pencatatan posisi indeks
+ */
+struct CSVScanner
+{
+#if defined(CSV_SCANNER_AVX2)
+    static constexpr size_t blockSize = 32;
+#elif defined(CSV_SCANNER_SSE2)
+    static constexpr size_t blockSize = 16;
+#else
+    static constexpr size_t blockSize = 8;
+#endif
+
+    char separator;
+    bool isStructural[256];
+
+    explicit CSVScanner(char separator = ',')
+    {
+        this->separator = separator;
+
+        for (size_t i = 0; i < 256; i++)
+            isStructural[i] = false;
+
+        isStructural[static_cast<unsigned char>(separator)] = true;
+        isStructural[static_cast<unsigned char>('"')] = true;
+        isStructural[static_cast<unsigned char>('\\')] = true;
+        isStructural[static_cast<unsigned char>('\r')] = true;
+        isStructural[static_cast<unsigned char>('\n')] = true;
+    }
+
+    static unsigned countTrailingZero(uint32_t x)
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, x);
+        return index;
+#else
+        return __builtin_ctz(x);
+#endif
+    }
+
+    /**
+     * Bitmask karakter struktural pada blok yang dimulai dari p
+     * p harus mempunyai minimal blockSize byte
+     */
+    uint32_t blockMask(const char *p) const
+    {
+#if defined(CSV_SCANNER_AVX2)
+        __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        __m256i mask = _mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_cmpeq_epi8(block, _mm256_set1_epi8(separator)),
+                _mm256_cmpeq_epi8(block, _mm256_set1_epi8('"'))),
+            _mm256_or_si256(
+                _mm256_or_si256(
+                    _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\')),
+                    _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r'))),
+                _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'))));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(mask));
+#elif defined(CSV_SCANNER_SSE2)
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i mask = _mm_or_si128(
+            _mm_or_si128(
+                _mm_cmpeq_epi8(block, _mm_set1_epi8(separator)),
+                _mm_cmpeq_epi8(block, _mm_set1_epi8('"'))),
+            _mm_or_si128(
+                _mm_or_si128(
+                    _mm_cmpeq_epi8(block, _mm_set1_epi8('\\')),
+                    _mm_cmpeq_epi8(block, _mm_set1_epi8('\r'))),
+                _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'))));
+        return static_cast<uint32_t>(_mm_movemask_epi8(mask));
+#else
+        uint32_t mask = 0;
+        for (size_t i = 0; i < blockSize; i++)
+            mask |= static_cast<uint32_t>(isStructural[static_cast<unsigned char>(p[i])]) << i;
+        return mask;
+#endif
+    }
+
+    /**
+     * Mencari indeks karakter struktural pertama dari p[0] sampai p[size - 1]
+     * Mengembalikan size jika tidak ditemukan
+     */
+    size_t find(const char *p, size_t size) const
+    {
+        size_t i = 0;
+
+        while (i + blockSize <= size)
+        {
+            uint32_t mask = blockMask(p + i);
+            if (mask != 0)
+                return i + countTrailingZero(mask);
+            i += blockSize;
+        }
+
+        while (i < size && !isStructural[static_cast<unsigned char>(p[i])])
+            i++;
+
+        return i;
+    }
+};
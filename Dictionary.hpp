@@ -0,0 +1,118 @@
+#pragma once
+
+#include <string>
+#include <deque>
+#include "RobinHoodHashMap.hpp"
+#include "HalfSipHash.h"
+#include "Utf8.hpp"
+#include "Utils.hpp"
+
+// Kode nilai di Dictionary, lihat penjelasan Dictionary
+using DictionaryCode = const std::wstring *;
+
+/**
+ * Kunci pencarian di kamus, menunjuk ke nilai yang sudah disimpan di kamus
+ * sehingga nilai tidak disimpan dua kali (di deque dan sebagai kunci hash table)
+ * Saat mencari, kunci menunjuk ke string yang dicari
+ */
+struct DictionaryKey
+{
+    const std::wstring *value;
+
+    bool operator==(const DictionaryKey &other) const
+    {
+        return *value == *other.value;
+    }
+};
+
+struct DictionaryHasher
+{
+    uint64_t seed = 0x2b7e151628aed2a6;
+
+    uint64_t hash(const std::wstring &value)
+    {
+        return HalfSipHash_64(value.data(), sizeof(wchar_t) * value.size(), &seed);
+    }
+
+    uint64_t hash(const DictionaryKey &key)
+    {
+        return hash(*key.value);
+    }
+
+    uint64_t hash(const std::string &value)
+    {
+        return HalfSipHash_64(value.data(), value.size(), &seed);
+    }
+};
+
+/**
+ * Kamus untuk kolom dengan sedikit nilai berbeda (low cardinality), misalnya kategori atau negara
+ * Setiap nilai berbeda hanya disimpan sekali, record cukup menyimpan kode dari nilai tersebut
+ *
+ * Kode adalah pointer ke nilai di dalam kamus (DictionaryCode)
+ * Nilai disimpan di std::deque sehingga pointer tidak berubah saat nilai baru ditambahkan,
+ * thread UI bisa membaca nilai dari kode tanpa mengakses kamus
+ * Dua record mempunyai nilai yang sama jika dan hanya jika kodenya sama
+ *
+ * Penambahan nilai (intern) tidak thread safe, lakukan hanya di satu thread (WorkerThread)
+ */
+struct Dictionary
+{
+    std::deque<std::wstring> values;
+    RobinHoodHashMap<DictionaryKey, DictionaryCode, DictionaryHasher> codes;
+    // Kode berdasarkan byte UTF-8, digunakan saat memuat CSV agar nilai yang sudah ada tidak didekode ulang
+    RobinHoodHashMap<std::string, DictionaryCode, DictionaryHasher> utf8Codes;
+
+    DictionaryCode intern(const std::wstring &value)
+    {
+        DictionaryCode *code = codes.get(DictionaryKey{&value});
+        if (code != nullptr)
+            return *code;
+
+        values.push_back(value);
+        DictionaryCode result = &values.back();
+        codes.put(DictionaryKey{result}, result);
+        return result;
+    }
+
+    DictionaryCode internUtf8(const std::string &bytes)
+    {
+        DictionaryCode *code = utf8Codes.get(bytes);
+        if (code != nullptr)
+            return *code;
+
+        DictionaryCode result = intern(Utf8::toWString(bytes.data(), bytes.size()));
+        utf8Codes.put(bytes, result);
+        return result;
+    }
+
+    // Mengembalikan nullptr jika value belum ada di kamus, kamus tidak diubah
+    DictionaryCode find(const std::wstring &value)
+    {
+        DictionaryCode *code = codes.get(DictionaryKey{&value});
+        return code == nullptr ? nullptr : *code;
+    }
+
+    size_t size() const
+    {
+        return values.size();
+    }
+
+    // Nilai dari kode, string kosong jika kode belum diisi (nullptr)
+    static const std::wstring &get(DictionaryCode code)
+    {
+        static const std::wstring empty;
+        return code == nullptr ? empty : *code;
+    }
+
+    /**
+     * Membandingkan dua kode sesuai urutan string (Utils::CompareWStringHalfInsensitive)
+     * Kode yang sama langsung dianggap sama tanpa membandingkan string
+     */
+    static int compare(DictionaryCode a, DictionaryCode b)
+    {
+        if (a == b)
+            return 0;
+        return Utils::CompareWStringHalfInsensitive(*a, *b);
+    }
+};
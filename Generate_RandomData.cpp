@@ -0,0 +1,446 @@
+/*
+    Generator data acak untuk seluruh aplikasi, pengganti Rumah_Sakit_Generate_RandomData.ps1
+    Tidak membutuhkan jaringan dan hasilnya selalu sama untuk jumlah baris dan seed yang sama
+
+    Penggunaan: Generate_RandomData <jumlah baris> [folder output] [seed]
+    Jumlah baris dapat ditulis dengan akhiran K atau M, misalnya 10K, 1M, atau 10M
+    Folder output default adalah data/generated, folder tersebut harus sudah ada
+
+    File yang dihasilkan (format sama dengan CSV yang dibaca aplikasi):
+    - products.csv (Kelontong)
+    - books.csv (Perpustakaan)
+    - Rumah_Sakit.csv (Rumah Sakit)
+    - FestDataFiksBgt.csv (Planner Acara)
+    - ppdb.csv (PPDB)
+*/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include "Timer.hpp"
+
+/**
+ * Generator bilangan acak SplitMix64
+ * Tidak menggunakan distribusi dari <random> karena hasilnya bisa berbeda antar implementasi library standar
+ */
+struct Random
+{
+    uint64_t state;
+
+    explicit Random(uint64_t seed)
+    {
+        state = seed;
+    }
+
+    uint64_t next()
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    // Bilangan acak dari 0 sampai n - 1
+    uint64_t below(uint64_t n)
+    {
+        return next() % n;
+    }
+
+    // Bilangan acak dari min sampai max
+    int64_t between(int64_t min, int64_t max)
+    {
+        return min + static_cast<int64_t>(below(static_cast<uint64_t>(max - min + 1)));
+    }
+
+    // Bernilai true dengan peluang percent persen
+    bool chance(unsigned percent)
+    {
+        return below(100) < percent;
+    }
+
+    template <typename T, size_t N>
+    const T &pick(const T (&values)[N])
+    {
+        return values[below(N)];
+    }
+};
+
+// Batas jumlah baris, kunci terkecil (Festival_ID) mempunyai 10^8 nilai berbeda
+const uint64_t maxRows = 100000000;
+
+/**
+ * Mengubah indeks baris menjadi angka unik dengan urutan acak
+ * index * multiplier mod modulus adalah bijeksi jika multiplier dan modulus relatif prima,
+ * sehingga kunci tidak pernah sama tetapi tidak terurut seperti data asli
+ * index < maxRows dan multiplier < 2^34 sehingga perkalian tidak melebihi 64 bit
+ */
+uint64_t ScatterIndex(uint64_t index, uint64_t multiplier, uint64_t modulus)
+{
+    return (index * multiplier + 1) % modulus;
+}
+
+std::string PadNumber(uint64_t value, size_t width)
+{
+    std::string result = std::to_string(value);
+    if (result.size() < width)
+        result.insert(0, width - result.size(), '0');
+    return result;
+}
+
+/**
+ * Tanggal sebagai jumlah hari sejak 1 Januari tahun awal
+ */
+struct Date
+{
+    int day, month, year;
+
+    static bool isLeapYear(int year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    static int daysInMonth(int month, int year)
+    {
+        const int days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+        return month == 2 && isLeapYear(year) ? 29 : days[month - 1];
+    }
+
+    static Date fromDayIndex(int dayIndex, int startYear)
+    {
+        Date date{1, 1, startYear};
+
+        while (dayIndex >= (isLeapYear(date.year) ? 366 : 365))
+        {
+            dayIndex -= isLeapYear(date.year) ? 366 : 365;
+            date.year++;
+        }
+
+        while (dayIndex >= daysInMonth(date.month, date.year))
+        {
+            dayIndex -= daysInMonth(date.month, date.year);
+            date.month++;
+        }
+
+        date.day += dayIndex;
+        return date;
+    }
+
+    // Format dd/mm/yyyy
+    std::string str() const
+    {
+        return PadNumber(day, 2) + "/" + PadNumber(month, 2) + "/" + std::to_string(year);
+    }
+};
+
+/**
+ * Menulis baris CSV ke file dengan buffer besar
+ * Sel yang mengandung pemisah, petik, atau baris baru diapit petik dan petik di dalamnya digandakan
+ * Backslash selalu di-escape karena CSVReader membacanya sebagai karakter escape
+ */
+struct CSVWriter
+{
+    std::ofstream stream;
+    std::string buffer;
+    char separator;
+    bool quoteAll;
+    bool firstCell = true;
+    uint64_t bytes = 0;
+
+    CSVWriter(const std::string &path, char separator, bool quoteAll)
+    {
+        // Binary agar baris selalu diakhiri \n di semua sistem operasi
+        stream.open(path, std::ios::binary | std::ios::trunc);
+        if (!stream)
+            throw std::domain_error("Cannot create " + path);
+
+        this->separator = separator;
+        this->quoteAll = quoteAll;
+        buffer.reserve(1024 * 1024);
+    }
+
+    ~CSVWriter()
+    {
+        flush();
+    }
+
+    CSVWriter &cell(const std::string &value)
+    {
+        if (!firstCell)
+            buffer += separator;
+        firstCell = false;
+
+        bool needQuote = quoteAll || value.find_first_of(std::string{separator, '"', '\n'}) != std::string::npos;
+        if (!needQuote && value.find('\\') == std::string::npos)
+        {
+            buffer += value;
+            return *this;
+        }
+
+        if (needQuote)
+            buffer += '"';
+        for (char ch : value)
+        {
+            if (ch == '\\' || (needQuote && ch == '"'))
+                buffer += ch;
+            buffer += ch;
+        }
+        if (needQuote)
+            buffer += '"';
+        return *this;
+    }
+
+    void endRow()
+    {
+        buffer += '\n';
+        firstCell = true;
+
+        if (buffer.size() >= 1024 * 1024)
+            flush();
+    }
+
+    void flush()
+    {
+        stream.write(buffer.data(), buffer.size());
+        bytes += buffer.size();
+        buffer.clear();
+    }
+};
+
+const char *firstNames[] = {
+    "Lucas", "Gabriella", "Andi", "Budi", "Citra", "Dewi", "Eko", "Fajar", "Gita", "Hendra",
+    "Indah", "Joko", "Kartika", "Lestari", "Made", "Nur", "Oktaviani", "Putri", "Rizki", "Sari",
+    "Taufik", "Utami", "Wahyu", "Yusuf", "Zahra", "Emma", "Liam", "Olivia", "Noah", "Ava",
+    "Ethan", "Sophia", "Mason", "Isabella", "Logan", "Mia", "James", "Charlotte", "Benjamin", "Amelia"};
+
+const char *lastNames[] = {
+    "Harper", "Perez", "Saputra", "Wijaya", "Santoso", "Pratama", "Hidayat", "Nugroho", "Kusuma", "Setiawan",
+    "Rahmawati", "Susanto", "Siregar", "Nasution", "Lubis", "Simanjuntak", "Purnomo", "Halim", "Gunawan", "Tanjung",
+    "Smith", "Johnson", "Williams", "Brown", "Jones", "Garcia", "Miller", "Davis", "Rodriguez", "Martinez",
+    "Wilson", "Anderson", "Taylor", "Thomas", "Moore", "Jackson", "Martin", "Lee", "Thompson", "White"};
+
+std::string RandomPersonName(Random &random)
+{
+    return std::string(random.pick(firstNames)) + " " + random.pick(lastNames);
+}
+
+void GenerateProducts(const std::string &path, uint64_t rows, Random &random)
+{
+    const char *categories[] = {
+        "Fresh Vegetable", "Fresh Fruit", "Meat", "Seafood", "Dairy", "Bakery", "Frozen Food", "Snack",
+        "Beverage", "Instant Noodle", "Rice", "Cooking Oil", "Spices", "Personal Care", "Household", "Baby Care"};
+    const char *adjectives[] = {
+        "English", "Green", "Red", "Organic", "Premium", "Fresh", "Sweet", "Spicy", "Crispy", "Original",
+        "Low Fat", "Family Pack", "Mini", "Jumbo", "Golden", "Classic"};
+    const char *nouns[] = {
+        "Cucumber", "Onion", "Apple", "Chicken Breast", "Salmon", "Milk", "Bread", "Nugget", "Chips", "Tea",
+        "Noodle", "Rice", "Palm Oil", "Pepper", "Shampoo", "Detergent", "Diaper", "Cheese", "Yogurt", "Coffee"};
+    const char *units[] = {"250g", "500g", "1kg", "1L", "2L", "6 pcs", "12 pcs", "Pack"};
+
+    CSVWriter writer(path, ';', false);
+    writer.cell("sku").cell("name").cell("category").cell("price").endRow();
+
+    for (uint64_t i = 0; i < rows; i++)
+    {
+        std::string sku = PadNumber(ScatterIndex(i, 6364136223ULL, 100000000000ULL), 11) + "_EA";
+        std::string name = std::string(random.pick(adjectives)) + " " + random.pick(nouns) + " " + random.pick(units);
+
+        // Sebagian kecil nama mengandung pemisah atau petik sehingga parser juga melewati jalur escape
+        if (random.chance(1))
+            name += "; Promo";
+        else if (random.chance(1))
+            name = "\"" + name + "\"";
+
+        writer.cell(sku).cell(name).cell(random.pick(categories)).cell(std::to_string(random.between(10, 5000) * 10)).endRow();
+    }
+}
+
+void GenerateBooks(const std::string &path, uint64_t rows, Random &random)
+{
+    const char *titleWords[] = {
+        "Laskar", "Pelangi", "Bumi", "Manusia", "Ronggeng", "Dukuh", "Paruk", "Cantik", "Itu", "Luka",
+        "Classical", "Mythology", "Clara", "Callan", "Decision", "Normandy", "Flu", "Story", "Great",
+        "Influenza", "Mummies", "Urumchi", "Kitchen", "God", "Journey", "Night", "Garden", "Silent", "River", "Stone"};
+    const char *publishers[] = {
+        "Gramedia Pustaka Utama", "Bentang Pustaka", "Mizan", "Erlangga", "Oxford University Press",
+        "HarperFlamingo Canada", "HarperPerennial", "Farrar Straus Giroux", "W. W. Norton & Company", "Penguin Books"};
+
+    CSVWriter writer(path, ';', false);
+    writer.cell("ISBN").cell("Book-Title").cell("Book-Author").cell("Year-Of-Publication").cell("Publisher").endRow();
+
+    for (uint64_t i = 0; i < rows; i++)
+    {
+        std::string isbn = PadNumber(ScatterIndex(i, 2862933557ULL, 10000000000ULL), 10);
+
+        std::string title = random.pick(titleWords);
+        int wordCount = static_cast<int>(random.between(1, 5));
+        for (int w = 0; w < wordCount; w++)
+            title += std::string(" ") + random.pick(titleWords);
+
+        writer.cell(isbn).cell(title).cell(RandomPersonName(random)).cell(std::to_string(random.between(1950, 2024))).cell(random.pick(publishers)).endRow();
+    }
+}
+
+void GeneratePatients(const std::string &path, uint64_t rows, Random &random)
+{
+    // Sama dengan skrip lama: tanggal masuk 01/01/2023 - 12/12/2024, tanggal keluar setelah tanggal masuk sampai 25/12/2024
+    const int lastStartDay = 711;
+    const int lastEndDay = 724;
+
+    // Seperti hasil Export-Csv, seluruh sel diapit petik dan dipisahkan koma
+    CSVWriter writer(path, ',', true);
+    writer.cell("ID").cell("Name").cell("Group").cell("StartDate").cell("EndDate").endRow();
+
+    for (uint64_t i = 1; i <= rows; i++)
+    {
+        int start = static_cast<int>(random.between(0, lastStartDay));
+        int end = static_cast<int>(random.between(start + 1, lastEndDay));
+
+        writer.cell(PadNumber(i, 9))
+            .cell(RandomPersonName(random))
+            .cell(std::string(1, static_cast<char>('A' + random.below(5))))
+            .cell(Date::fromDayIndex(start, 2023).str())
+            .cell(Date::fromDayIndex(end, 2023).str())
+            .endRow();
+    }
+}
+
+void GenerateFestivals(const std::string &path, uint64_t rows, Random &random)
+{
+    const char *nameWords[] = {
+        "Glastonbury", "Tomorrowland", "Coachella", "Java Jazz", "Soundrenaline", "We The Fest", "Primavera", "Sziget",
+        "Fuji Rock", "Roskilde", "Lollapalooza", "Ultra", "Djakarta Warehouse", "Synchronize", "Pestapora", "Prambanan Jazz"};
+    const char *locations[] = {
+        "Somerset", "Boom", "Indio", "Jakarta", "Bali", "Barcelona", "Budapest", "Niigata",
+        "Roskilde", "Chicago", "Miami", "Yogyakarta", "Bandung", "Surabaya", "Tokyo", "Berlin"};
+    const char *countries[] = {"UK", "Belgium", "USA", "Indonesia", "Spain", "Hungary", "Japan", "Denmark", "Germany"};
+    const char *genres[] = {"Various", "EDM", "Jazz", "Rock", "Pop", "Indie", "Hip Hop", "Dangdut", "Classical"};
+    const char *descriptions[] = {
+        "Salah satu festival musik dan seni terbesar di dunia. Festival ini menampilkan berbagai genre musik dan pertunjukan seni.",
+        "Festival EDM terkenal dengan dekorasi spektakuler dan penampilan DJ terkemuka.",
+        "Festival tahunan yang menghadirkan musisi lokal dan internasional.",
+        "Festival dengan panggung terbuka; pengunjung dapat berkemah di sekitar lokasi.",
+        "Festival yang dikenal dengan suasana \"santai\" dan kuliner khas daerah."};
+
+    CSVWriter writer(path, ';', false);
+    writer.cell("Festival_ID").cell("Festival_Name").cell("Location").cell("Country").cell("Genre").cell("Visitor").cell("Date").cell("Description").endRow();
+
+    for (uint64_t i = 0; i < rows; i++)
+    {
+        std::string name = std::string(random.pick(nameWords)) + " Festival " + std::to_string(2000 + random.below(25));
+        std::string id = std::string(1, name[0]) + PadNumber(ScatterIndex(i, 48271ULL, 100000000ULL), 8);
+        int date = static_cast<int>(random.between(0, 729));
+
+        writer.cell(id)
+            .cell(name)
+            .cell(random.pick(locations))
+            .cell(random.pick(countries))
+            .cell(random.pick(genres))
+            .cell(std::to_string(random.between(1, 400) * 1000))
+            .cell(Date::fromDayIndex(date, 2023).str())
+            .cell(random.pick(descriptions))
+            .endRow();
+    }
+}
+
+void GenerateStudents(const std::string &path, uint64_t rows, Random &random)
+{
+    const char *schools[] = {
+        "SMP Negeri 1 Yogyakarta", "SMP Negeri 5 Yogyakarta", "SMP Negeri 8 Yogyakarta", "SMP Muhammadiyah 2 Yogyakarta",
+        "SMP Negeri 1 Sleman", "SMP Negeri 4 Depok", "SMP Negeri 2 Bantul", "SMP Kanisius Gayam", "MTs Negeri 1 Yogyakarta"};
+    const char *entries[] = {"Rapot", "Zonasi", "Prestasi"};
+    const char passwordChars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+    CSVWriter writer(path, ';', false);
+    writer.cell("NISN").cell("Name").cell("Origin").cell("Entry").cell("Password").endRow();
+
+    for (uint64_t i = 0; i < rows; i++)
+    {
+        std::string password(10, ' ');
+        for (char &ch : password)
+            ch = passwordChars[random.below(sizeof(passwordChars) - 1)];
+
+        writer.cell(PadNumber(ScatterIndex(i, 1103515243ULL, 10000000000ULL), 10))
+            .cell(RandomPersonName(random))
+            .cell(random.pick(schools))
+            .cell(random.pick(entries))
+            .cell(password)
+            .endRow();
+    }
+}
+
+// Membaca jumlah baris dengan akhiran K atau M opsional
+uint64_t ParseRowCount(const std::string &text)
+{
+    if (text.empty())
+        throw std::domain_error("Empty row count");
+
+    uint64_t multiplier = 1;
+    std::string digits = text;
+    char suffix = text.back();
+    if (suffix == 'K' || suffix == 'k')
+        multiplier = 1000;
+    else if (suffix == 'M' || suffix == 'm')
+        multiplier = 1000000;
+
+    if (multiplier != 1)
+        digits.pop_back();
+
+    if (digits.empty() || digits.find_first_not_of("0123456789") != std::string::npos)
+        throw std::domain_error("Invalid row count " + text);
+
+    return std::stoull(digits) * multiplier;
+}
+
+/**
+ * Setiap file memakai seed sendiri (seed ditambah fileIndex)
+ * sehingga isi file tidak bergantung pada file lain yang dibuat sebelumnya
+ */
+template <typename Generate>
+void GenerateFile(const std::string &path, uint64_t rows, uint64_t seed, uint64_t fileIndex, Generate generate)
+{
+    Random random(seed * 0x100000001b3 + fileIndex);
+
+    Timer timer;
+    timer.start();
+    generate(path, rows, random);
+    timer.end();
+
+    printf("%s: %llu baris dalam %.2f s\n", path.c_str(), static_cast<unsigned long long>(rows),
+           std::chrono::duration<double>(timer.duration).count());
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        printf("Penggunaan: %s <jumlah baris, misalnya 10K, 1M, 10M> [folder output] [seed]\n", argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        uint64_t rows = ParseRowCount(argv[1]);
+        std::string directory = argc >= 3 ? argv[2] : "data/generated";
+        uint64_t seed = argc >= 4 ? std::stoull(argv[3]) : 20241225;
+
+        if (rows > maxRows)
+            throw std::domain_error("Row count exceed " + std::to_string(maxRows));
+
+        GenerateFile(directory + "/products.csv", rows, seed, 1, GenerateProducts);
+        GenerateFile(directory + "/books.csv", rows, seed, 2, GenerateBooks);
+        GenerateFile(directory + "/Rumah_Sakit.csv", rows, seed, 3, GeneratePatients);
+        GenerateFile(directory + "/FestDataFiksBgt.csv", rows, seed, 4, GenerateFestivals);
+        GenerateFile(directory + "/ppdb.csv", rows, seed, 5, GenerateStudents);
+    }
+    catch (const std::exception &e)
+    {
+        printf("Error: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
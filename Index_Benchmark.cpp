@@ -0,0 +1,223 @@
+/*
+    Benchmark index terurut: RBTree dibandingkan dengan BPlusTree
+    Menggunakan products.csv dari Generate_RandomData, dapat dijalankan di Windows maupun Linux
+
+    Penggunaan: Index_Benchmark [folder data] [jumlah pengulangan]
+    Folder data default adalah data/generated, pengulangan default 1
+    Jika pengulangan lebih dari 1, waktu tercepat yang ditampilkan
+
+    Yang diukur untuk setiap index:
+    - insert seluruh produk satu per satu sesuai urutan di CSV
+    - penelusuran inorder seluruh produk (seperti "Tampilkan" In-order)
+    - pencarian rentang nama (seperti tab pencarian rentang)
+    - pencarian setiap produk
+    - remove setengah produk
+    Kode pengukuran sama untuk kedua index, index dipilih melalui parameter template
+    Setiap index diukur dua kali: dengan kunci urutan (Utils::SortKey) dan dengan CompareWStringHalfInsensitive
+    Operasi yang dipakai hanya begin, end, lowerBound, insert, dan remove yang dimiliki kedua index
+*/
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "CSVReader.hpp"
+#include "RBTree.hpp"
+#include "BPlusTree.hpp"
+#include "Utils.hpp"
+#include "Timer.hpp"
+
+// Sama dengan Product di Kelontong.cpp, tanpa kamus kategori
+struct Product
+{
+    std::wstring sku;
+    std::wstring name;
+    std::wstring category;
+    std::wstring price;
+    std::string sortKey;
+};
+
+void UpdateSortKey(Product &product)
+{
+    product.sortKey = Utils::SortKey(product.name, product.sku);
+}
+
+struct ProductNameCompare
+{
+    int compare(const Product &a, const Product &b)
+    {
+        return Utils::CompareSortKey(a.sortKey, b.sortKey);
+    }
+};
+
+// Perbandingan sebelum ada kunci urutan, untuk mengukur selisihnya
+struct ProductNameCompareWString
+{
+    int compare(const Product &a, const Product &b)
+    {
+        int compare = Utils::CompareWStringHalfInsensitive(a.name, b.name);
+
+        if (compare != 0)
+            return compare;
+
+        return Utils::CompareWStringHalfInsensitive(a.sku, b.sku);
+    }
+};
+
+Product ProductBound(const std::wstring &sku, const std::wstring &name)
+{
+    Product product{sku, name};
+    UpdateSortKey(product);
+    return product;
+}
+
+std::vector<Product> ReadProducts(const std::string &path)
+{
+    CSVReader<CSVReaderIOMapped> reader(path, ';');
+    reader.startRead();
+    reader.projection = true;
+
+    int skuIndex = reader.findHeaderIndex("sku");
+    int nameIndex = reader.findHeaderIndex("name");
+    int categoryIndex = reader.findHeaderIndex("category");
+    int priceIndex = reader.findHeaderIndex("price");
+
+    std::vector<Product> products;
+    while (reader.readData())
+    {
+        Product product;
+        Utils::stringviewsToWstrings(reader.data, {{skuIndex, &product.sku},
+                                                   {nameIndex, &product.name},
+                                                   {categoryIndex, &product.category},
+                                                   {priceIndex, &product.price}});
+        UpdateSortKey(product);
+        products.push_back(std::move(product));
+    }
+    return products;
+}
+
+template <typename Run>
+double Measure(size_t repeat, Run run)
+{
+    double best = 0;
+
+    for (size_t i = 0; i < repeat; i++)
+    {
+        Timer timer;
+        timer.start();
+        run();
+        timer.end();
+
+        double seconds = std::chrono::duration<double>(timer.duration).count();
+        if (i == 0 || seconds < best)
+            best = seconds;
+    }
+
+    return best;
+}
+
+void PrintResult(const char *index, const char *operation, size_t operations, double seconds)
+{
+    printf("%-14s %-22s %10zu operasi %9.3f s %12.0f operasi/s\n",
+           index, operation, operations, seconds, operations / (seconds > 0 ? seconds : 1e-9));
+}
+
+template <typename Index, typename Compare>
+void RunBenchmark(const char *name, const std::vector<Product> &products, size_t repeat)
+{
+    Compare comparer;
+
+    // Setiap pengukuran memakai index baru yang diisi dengan cara yang sama
+    auto build = [&](Index &index)
+    {
+        for (const Product &product : products)
+        {
+            Product copy = product;
+            index.insert(std::move(copy));
+        }
+    };
+
+    double seconds = Measure(repeat, [&]()
+                             {
+                                 Index index;
+                                 build(index);
+                             });
+    PrintResult(name, "insert", products.size(), seconds);
+
+    Index index;
+    build(index);
+
+    size_t visited = 0;
+    seconds = Measure(repeat, [&]()
+                      {
+                          visited = 0;
+                          for (const Product &product : index)
+                              visited += product.name.size() > 0;
+                      });
+    PrintResult(name, "inorder", visited, seconds);
+
+    // Rentang antara nama dua produk yang dipilih tersebar
+    size_t rangeCount = std::min<size_t>(products.size(), 10000);
+    size_t rangeResults = 0;
+    seconds = Measure(repeat, [&]()
+                      {
+                          rangeResults = 0;
+                          for (size_t i = 0; i < rangeCount; i++)
+                          {
+                              const Product &from = products[i];
+                              const Product &to = products[(i * 7919 + 1) % products.size()];
+                              Product low = ProductBound(L".", std::min(from.name, to.name));
+                              Product high = ProductBound(L":", std::max(from.name, to.name));
+                              // Sama seperti list view, cukup 100 hasil pertama yang dibaca
+                              size_t results = 0;
+                              for (auto it = index.lowerBound(low); it != index.end() && results < 100 && comparer.compare(*it, high) <= 0; ++it)
+                                  results++;
+                              rangeResults += results;
+                          }
+                      });
+    PrintResult(name, "rentang (100 pertama)", rangeResults, seconds);
+
+    size_t found = 0;
+    seconds = Measure(repeat, [&]()
+                      {
+                          found = 0;
+                          for (const Product &product : products)
+                          {
+                              auto it = index.lowerBound(product);
+                              found += it != index.end() && comparer.compare(*it, product) == 0;
+                          }
+                      });
+    PrintResult(name, "find", found, seconds);
+
+    seconds = Measure(1, [&]()
+                      {
+                          for (size_t i = 0; i < products.size(); i += 2)
+                              index.remove(products[i]);
+                      });
+    PrintResult(name, "remove", (products.size() + 1) / 2, seconds);
+}
+
+int main(int argc, char **argv)
+{
+    std::string directory = argc >= 2 ? argv[1] : "data/generated";
+    size_t repeat = argc >= 3 ? std::stoul(argv[2]) : 1;
+
+    try
+    {
+        std::vector<Product> products = ReadProducts(directory + "/products.csv");
+        printf("Folder data: %s, produk: %zu, pengulangan: %zu\n", directory.c_str(), products.size(), repeat);
+
+        RunBenchmark<RBTree<Product, ProductNameCompare>, ProductNameCompare>("RBTree", products, repeat);
+        RunBenchmark<BPlusTree<Product, ProductNameCompare>, ProductNameCompare>("BPlusTree", products, repeat);
+        // Index yang sama dengan perbandingan string per karakter
+        RunBenchmark<RBTree<Product, ProductNameCompareWString>, ProductNameCompareWString>("RBTree (w)", products, repeat);
+        RunBenchmark<BPlusTree<Product, ProductNameCompareWString>, ProductNameCompareWString>("BPlusTree (w)", products, repeat);
+    }
+    catch (const std::exception &e)
+    {
+        printf("Error: %s\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
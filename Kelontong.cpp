@@ -8,29 +8,43 @@
 #include "unordered_map"
 #include "WorkerThread.hpp"
 #include "TopKLargest.hpp"
+#include "Snapshot.hpp"
+#include "Dictionary.hpp"
 #include <stdlib.h>
 
 struct Product
 {
     std::wstring sku;
     std::wstring name;
-    std::wstring category;
+    // Kode dari kamus categories
+    DictionaryCode category;
     std::wstring price;
+    // Kunci urutan nama lalu SKU, diisi UpdateSortKey setiap nama atau SKU berubah
+    std::string sortKey;
 };
 
+void UpdateSortKey(Product &product)
+{
+    product.sortKey = Utils::SortKey(product.name, product.sku);
+}
+
+// Sama dengan CompareWStringHalfInsensitive nama lalu SKU, melalui kunci urutan
 struct ProductNameCompare
 {
     int compare(const Product &a, const Product &b)
     {
-        int compare = Utils::CompareWStringHalfInsensitive(a.name, b.name);
-
-        if (compare != 0)
-            return compare;
-
-        return Utils::CompareWStringHalfInsensitive(a.sku, b.sku);
+        return Utils::CompareSortKey(a.sortKey, b.sortKey);
     }
 };
 
+// Produk batas untuk pencarian rentang nama
+Product ProductBound(const std::wstring &sku, const std::wstring &name)
+{
+    Product product{sku, name};
+    UpdateSortKey(product);
+    return product;
+}
+
 int CompareNumericWString(const std::wstring &a, const std::wstring &b)
 {
     long numA = std::stol(a);
@@ -64,11 +78,19 @@ struct ProductNameHasher
     }
 };
 
+// Kunci hash table untuk putMany dan removeMany
+const std::wstring &ProductSKU(const Product &product)
+{
+    return product.sku;
+}
+
 RBTree<Product, ProductNameCompare> tree;
 RobinHoodHashMap<std::wstring, Product, ProductNameHasher> hashTable;
+Dictionary categories;
 RBTree<Product, ProductNameCompare> removeHistoryTree;
 
 void ClearAllList();
+void EnqueueLoadAppended();
 // Jangan merefresh caller window
 void EnqueueRefreshAll(UI::Window *callerWindow);
 
@@ -87,12 +109,18 @@ namespace AddWindow
     UI::TextBox hargaTextBox;
     UI::Button btnAdd;
     Product product;
+    std::wstring category;
 
     void DoAdd()
     {
         Timer t;
 
+        // List yang mengambil baris langsung dari tree tidak boleh dibaca saat tree diubah
+        ClearAllList();
+
         t.start();
+        product.category = categories.intern(category);
+        UpdateSortKey(product);
         hashTable.put(product.sku, product);
         tree.insert(std::move(product));
         t.end();
@@ -107,8 +135,9 @@ namespace AddWindow
         product = Product{
             skuTextBox.getText(),
             namaTextBox.getText(),
-            kategoriTextBox.getText(),
+            nullptr,
             hargaTextBox.getText()};
+        category = kategoriTextBox.getText();
 
         product.price.erase(product.price.find_last_not_of(' ') + 1);
         product.price.erase(0, product.price.find_first_not_of(' '));
@@ -151,7 +180,7 @@ namespace AddWindow
             {
                 throw std::domain_error("Nama Tidak Boleh Kosong");
             }
-            if (product.category.size() == 0)
+            if (category.size() == 0)
             {
                 throw std::domain_error("Kategori Tidak Boleh Kosong");
             }
@@ -182,7 +211,7 @@ namespace AddWindow
                 throw std::domain_error("Harga Harus Berupa Angka");
             }
 
-            if (product.category.size() == 0)
+            if (category.size() == 0)
             {
                 throw std::domain_error("Kategori Tidak Boleh Kosong");
             }
@@ -242,8 +271,15 @@ namespace AddWindow
     }
 }
 
+/**
+ * Baris diambil langsung dari tree dengan select jika tree diisi (urutan inorder mulai dari treeFirst),
+ * sehingga tidak perlu menyalin pointer seluruh node setiap kali refresh
+ * Urutan lain (preorder, postorder, top K) tetap disalin ke items
+ */
 struct ProductListView : UI::VListView
 {
+    RBTree<Product, ProductNameCompare> *tree = nullptr;
+    size_t treeFirst = 0;
     std::vector<Product *> items;
 
     void Create(UI::Window *window, HWND hParent, POINT pos, SIZE size) override
@@ -258,15 +294,40 @@ struct ProductListView : UI::VListView
         InsertColumn(L"Harga", 100);
     }
 
+    Product *GetItem(int row)
+    {
+        if (tree != nullptr)
+            return &tree->select(treeFirst + row)->value;
+        return items[row];
+    }
+
+    // Menampilkan count nilai dari source mulai dari index first (inorder)
+    void ShowTree(RBTree<Product, ProductNameCompare> *source, size_t first, size_t count)
+    {
+        SetRowCount(0);
+        std::vector<Product *>().swap(items);
+        tree = source;
+        treeFirst = first;
+        SetRowCount(count);
+    }
+
+    // Menampilkan isi items
+    void ShowItems()
+    {
+        SetRowCount(0);
+        tree = nullptr;
+        SetRowCount(items.size());
+    }
+
     const std::wstring OnGetItem(int row, int column) override
     {
-        Product *product = items[row];
+        Product *product = GetItem(row);
         if (column == 0)
             return product->sku;
         else if (column == 1)
             return product->name;
         else if (column == 2)
-            return product->category;
+            return Dictionary::get(product->category);
         else if (column == 3)
             return product->price;
         return L"";
@@ -298,13 +359,15 @@ namespace TabHistoryDelete
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         progress.SetWaiting(true);
         message.ReplaceLastMessage(L"Memuat data");
 
         std::wstring type = combobox.GetSelectedText();
-        listView.items.resize(removeHistoryTree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -312,25 +375,31 @@ namespace TabHistoryDelete
         {
             timer.start();
 
-            size_t current = 0;
-            std::function<void(RBNode<Product> *)> visitor = [&](RBNode<Product> *node)
+            if (type == L"In-order")
             {
-                listView.items[current] = &node->value;
-                current++;
-            };
-
-            if (type == L"Pre-order")
-                removeHistoryTree.preorder(removeHistoryTree.root, visitor);
-            else if (type == L"In-order")
-                removeHistoryTree.inorder(removeHistoryTree.root, visitor);
-            else if (type == L"Post-order")
-                removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowTree(&removeHistoryTree, 0, removeHistoryTree.count);
+            }
+            else
+            {
+                listView.items.resize(removeHistoryTree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Product> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+
+                if (type == L"Pre-order")
+                    removeHistoryTree.preorder(removeHistoryTree.root, visitor);
+                else if (type == L"Post-order")
+                    removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowItems();
+            }
 
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(removeHistoryTree.count);
 
         message.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
         SetEnable(true);
@@ -340,7 +409,7 @@ namespace TabHistoryDelete
     {
         MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -357,21 +426,18 @@ namespace TabHistoryDelete
         std::vector<Product> products;
         for (int v : listView.GetSelectedIndex())
         {
-            products.push_back(*listView.items[v]);
+            products.push_back(*listView.GetItem(v));
         }
 
-        listView.SetRowCount(0);
+        ClearAllList();
 
         Timer t;
 
         t.start();
-        for (Product &product : products)
-        {
-            removeHistoryTree.remove(product);
-
-            hashTable.put(product.sku, product);
-            tree.insert(std::move(product));
-        }
+        // Seluruh data yang dipilih diproses sekaligus di setiap struktur
+        removeHistoryTree.removeMany(products);
+        hashTable.putMany(products, ProductSKU);
+        tree.insertBulk(std::move(products));
         t.end();
 
         progress.SetWaiting(false);
@@ -384,7 +450,7 @@ namespace TabHistoryDelete
         MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoRestore);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -440,6 +506,36 @@ void DoRemove(Product &&product, HWND window)
     removeHistoryTree.insert(std::move(product));
 }
 
+/**
+ * Menghapus banyak data sekaligus: setiap struktur diproses sekali untuk seluruh data
+ * Tree disusun ulang sekali dan hash table diperkecil sekali, bukan setiap data
+ */
+void DoRemoveMany(std::vector<Product> &&products, HWND window)
+{
+    if (tree.removeMany(products) != products.size())
+        MessageBoxA(window, "Penghapusan di RBTree gagal", "Gagal", MB_OK);
+
+    if (hashTable.removeMany(products, ProductSKU) != products.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(products));
+}
+
+/**
+ * Menghapus seluruh data dalam rentang tree sekaligus
+ * Rentang dilepas dari tree dengan split dan join tanpa menghapus node satu per satu,
+ * lalu data yang dilepas dihapus dari hash table dan dimasukkan ke riwayat sekaligus
+ */
+void DoRemoveRange(RBTree<Product, ProductNameCompare>::Range range, HWND window)
+{
+    std::vector<Product> products = tree.extractRange(range.begin(), range.end());
+
+    if (hashTable.removeMany(products, ProductSKU) != products.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(products));
+}
+
 void DoRemoveByListViewSelection(ProductListView *listView, UI::ProgressBar *progress, UI::LabelWorkMessage *message)
 {
     progress->SetWaiting(true);
@@ -448,7 +544,7 @@ void DoRemoveByListViewSelection(ProductListView *listView, UI::ProgressBar *pro
     std::vector<Product> selectedProduct;
     for (int v : listView->GetSelectedIndex())
     {
-        selectedProduct.push_back(*listView->items[v]);
+        selectedProduct.push_back(*listView->GetItem(v));
     }
 
     ClearAllList();
@@ -456,10 +552,7 @@ void DoRemoveByListViewSelection(ProductListView *listView, UI::ProgressBar *pro
     Timer t;
 
     t.start();
-    for (Product &produk : selectedProduct)
-    {
-        DoRemove(std::move(produk), listView->_window->hwnd);
-    }
+    DoRemoveMany(std::move(selectedProduct), listView->_window->hwnd);
     t.end();
 
     message->ReplaceLastMessage(L"Penghapusan selesai dalam " + t.durationStr() + L". Penghapusan mungkin terlihat lama karena proses mendapatkan pilihan dari UI");
@@ -478,7 +571,7 @@ void CopySKUByListViewSelection(ProductListView *listView)
         if (focusedIndexs.size() > 1)
             throw std::domain_error("Item yang dipilih lebih dari 1");
 
-        std::wstring sku = listView->items[focusedIndexs[0]]->sku;
+        std::wstring sku = listView->GetItem(focusedIndexs[0])->sku;
         Utils::CopyToClipboard(sku);
     }
     catch (std::domain_error const &e)
@@ -508,6 +601,9 @@ namespace TabCheapProducts
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Memproses data");
@@ -531,7 +627,7 @@ namespace TabCheapProducts
         }
         timer.end();
 
-        listView.SetRowCount(listSize);
+        listView.ShowItems();
         progress.SetWaiting(false);
         message.ReplaceLastMessage(L"Data ditemukan dalam " + timer.durationStr());
         SetEnable(true);
@@ -541,7 +637,7 @@ namespace TabCheapProducts
     {
         MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam param)
@@ -560,7 +656,7 @@ namespace TabCheapProducts
         MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -620,7 +716,7 @@ namespace TabFindProductsRange
     UI::Label fromLabel, toLabel;
     UI::TextBox fromTextBox, toTextBox;
     UI::Button btnFind;
-    UI::Button btnAdd, btnDelete, btnCopySKU;
+    UI::Button btnAdd, btnDelete, btnDeleteRange, btnCopySKU;
     UI::ProgressBar progress;
     UI::LabelWorkMessage label;
     ProductListView listView;
@@ -632,29 +728,61 @@ namespace TabFindProductsRange
         btnFind.SetEnable(enable);
         btnAdd.SetEnable(enable);
         btnDelete.SetEnable(enable);
+        btnDeleteRange.SetEnable(enable);
         btnCopySKU.SetEnable(enable);
         listView.SetEnable(enable);
     }
 
+    // Rentang yang ditampilkan dan dihapus tab ini, batasnya dicari dalam O(log n)
+    RBTree<Product, ProductNameCompare>::Range FindRange(const std::wstring &from, const std::wstring &to)
+    {
+        if (to.empty())
+        {
+            // Batas akhir kosong: semua data dengan nama berawalan batas awal
+            return tree.prefixRange(ProductBound(L".", from), [&](const Product &value)
+                                    { return Utils::StartsWith(value.name, from); });
+        }
+
+        return {tree.lowerBound(ProductBound(L".", from)), tree.upperBound(ProductBound(L":", to))};
+    }
+
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
+    // Batas dan jumlah hasil yang terakhir ditampilkan
+    // "Hapus Semua Hasil" menghapus rentang ini, bukan isi text box saat tombol ditekan
+    struct ShownRange
+    {
+        std::wstring from, to;
+        size_t count;
+        // WorkerThread::WriteVersion saat hasil ditampilkan
+        uint64_t version;
+    };
+    // Ditulis DoRefresh di thread pool baca dan dibaca thread UI
+    WorkerThread::Published<ShownRange> shown;
+
     void DoRefresh()
     {
-        listView.items.clear();
         listView.SetRowCount(0);
 
         label.ReplaceLastMessage(L"Menemukan data");
+        std::wstring from = fromTextBox.getText(), to = toTextBox.getText();
         Timer timer;
 
         progress.SetWaiting(true);
 
         {
+            // Index batas rentang dicari dengan indexOf, baris diambil dari tree saat ditampilkan
             timer.start();
-            tree.findBetween(Product{L".", fromTextBox.getText()}, {L":", toTextBox.getText()}, [&](RBNode<Product> *node)
-                             { listView.items.push_back(&node->value); });
+            auto range = FindRange(from, to);
+            size_t first = tree.indexOf(range.begin());
+            size_t last = tree.indexOf(range.end());
             timer.end();
+            listView.ShowTree(&tree, first, last > first ? last - first : 0);
+            shown.Set({from, to, last > first ? last - first : 0, WorkerThread::WriteVersion()});
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data ditemukan dalam " + timer.durationStr());
         progress.SetWaiting(false);
@@ -666,7 +794,7 @@ namespace TabFindProductsRange
     {
         MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam param)
@@ -685,7 +813,57 @@ namespace TabFindProductsRange
         MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
+        EnqueueRefreshAll(&window);
+        return 0;
+    }
+
+    // Menghapus seluruh hasil pencarian rentang, bukan hanya yang dipilih
+    void DoDeleteRange(const ShownRange &range)
+    {
+        progress.SetWaiting(true);
+        label.ReplaceLastMessage(L"Menghapus rentang");
+
+        // Hanya rentang yang dikonfirmasi yang dihapus, batal jika data berubah setelah hasil ditampilkan
+        auto current = FindRange(range.from, range.to);
+        size_t first = tree.indexOf(current.begin());
+        size_t last = tree.indexOf(current.end());
+        if (range.version != WorkerThread::WriteVersion() || (last > first ? last - first : 0) != range.count)
+        {
+            label.ReplaceLastMessage(L"Data berubah setelah hasil ditampilkan, tidak ada data yang dihapus");
+            MessageSetWait(&label, false);
+            progress.SetWaiting(false);
+            return;
+        }
+
+        ClearAllList();
+
+        Timer timer;
+        timer.start();
+        DoRemoveRange(current, window.hwnd);
+        timer.end();
+
+        label.ReplaceLastMessage(L"Penghapusan rentang selesai dalam " + timer.durationStr());
+        MessageSetWait(&label, false);
+        progress.SetWaiting(false);
+    }
+
+    LRESULT OnDeleteRangeClick(UI::CallbackParam param)
+    {
+        ShownRange range = shown.Get();
+        if (range.count == 0)
+            return 0;
+
+        std::wstring confirm = L"Hapus " + std::to_wstring(range.count) + L" data hasil pencarian? Data dapat dikembalikan dari riwayat penghapusan.";
+        if (MessageBoxW(window.hwnd, confirm.c_str(), L"Hapus Semua Hasil", MB_OKCANCEL | MB_ICONWARNING) != IDOK)
+            return 0;
+
+        // Rentang disalin ke tugas karena refresh berikutnya dapat mengganti rentang yang ditampilkan sebelum tugas berjalan
+        MessageSetWait(&label);
+        SetEnable(false);
+        WorkerThread::EnqueueWork([range]()
+                                  { DoDeleteRange(range); });
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -713,6 +891,9 @@ namespace TabFindProductsRange
         btnDelete.SetText(L"Hapus Produk");
         btnDelete.commandListener = OnDeleteClick;
 
+        btnDeleteRange.SetText(L"Hapus Semua Hasil");
+        btnDeleteRange.commandListener = OnDeleteRangeClick;
+
         window.controlsLayout = {
             {UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &fromLabel),
              UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &fromTextBox),
@@ -725,7 +906,8 @@ namespace TabFindProductsRange
             {UI::EmptyCell(UI::SIZE_FILL, UI::SIZE_DEFAULT),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnCopySKU),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnAdd),
-             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete)}};
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete),
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDeleteRange)}};
 
         UI::LayoutControls(&window, true);
 
@@ -747,6 +929,7 @@ namespace TabAllProducts
     UI::Button btnAdd;
     UI::Button btnDelete;
     UI::Button btnCopySKU;
+    UI::Button btnLoadAppended;
     UI::ProgressBar progress;
     UI::LabelWorkMessage label;
     ProductListView listView;
@@ -758,14 +941,17 @@ namespace TabAllProducts
         btnAdd.SetEnable(enable);
         btnDelete.SetEnable(enable);
         btnCopySKU.SetEnable(enable);
+        btnLoadAppended.SetEnable(enable);
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         std::wstring type = combobox.GetSelectedText();
 
-        listView.items.resize(tree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -775,23 +961,29 @@ namespace TabAllProducts
 
         {
             timer.start();
-            size_t current = 0;
-            std::function<void(RBNode<Product> *)> visitor = [&](RBNode<Product> *node)
-            {
-                listView.items[current] = &node->value;
-                current++;
-            };
             if (type == L"In-order")
-                tree.inorder(tree.root, visitor);
-            else if (type == L"Pre-order")
-                tree.preorder(tree.root, visitor);
-            else if (type == L"Post-order")
-                tree.postorder(tree.root, visitor);
+            {
+                listView.ShowTree(&tree, 0, tree.count);
+            }
+            else
+            {
+                listView.items.resize(tree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Product> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+                if (type == L"Pre-order")
+                    tree.preorder(tree.root, visitor);
+                else if (type == L"Post-order")
+                    tree.postorder(tree.root, visitor);
+                listView.ShowItems();
+            }
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
 
@@ -802,7 +994,7 @@ namespace TabAllProducts
     {
         MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -821,7 +1013,7 @@ namespace TabAllProducts
         MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -832,11 +1024,20 @@ namespace TabAllProducts
         return 0;
     }
 
+    LRESULT OnLoadAppendedClick(UI::CallbackParam param)
+    {
+        EnqueueLoadAppended();
+        return 0;
+    }
+
     LRESULT OnCreate(UI::CallbackParam param)
     {
         button.SetText(L"Tampilkan");
         button.commandListener = OnShowClick;
 
+        btnLoadAppended.SetText(L"Muat Data Baru");
+        btnLoadAppended.commandListener = OnLoadAppendedClick;
+
         btnAdd.SetText(L"Tambahkan Produk");
         btnAdd.commandListener = OnAddClick;
 
@@ -853,6 +1054,7 @@ namespace TabAllProducts
             {UI::ControlCell(UI::SIZE_FILL, UI::SIZE_DEFAULT, &label)},
             {UI::ControlCell(UI::SIZE_FILL, UI::SIZE_FILL, &listView)},
             {UI::EmptyCell(UI::SIZE_FILL, UI::SIZE_DEFAULT),
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnLoadAppended),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnCopySKU),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnAdd),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete)}};
@@ -894,6 +1096,9 @@ namespace TabDetailsProducts
         btnDelete.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         label.ReplaceLastMessage(L"Mencari produk sesuai dengan SKU");
@@ -917,7 +1122,7 @@ namespace TabDetailsProducts
 
             listView.SetText(0, 1, currentProduct.sku);
             listView.SetText(1, 1, currentProduct.name);
-            listView.SetText(2, 1, currentProduct.category);
+            listView.SetText(2, 1, Dictionary::get(currentProduct.category));
             listView.SetText(3, 1, currentProduct.price);
         }
         SetEnable(true);
@@ -927,7 +1132,7 @@ namespace TabDetailsProducts
     {
         MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam)
@@ -958,7 +1163,7 @@ namespace TabDetailsProducts
         MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
 
         return 0;
@@ -1013,39 +1218,197 @@ namespace MainWindow
     UI::StatusBar statusBar;
     UI::ProgressBar progressBar;
 
+    const std::string csvPath = "data/products.csv";
+    const std::string snapshotPath = "data/products.snapshot";
+    // Naikkan jika isi Product atau ProductNameCompare berubah
+    const uint32_t snapshotRecordVersion = 1;
+
+    void WriteProduct(SnapshotWriter &writer, const Product &product)
+    {
+        writer.writeWString(product.sku);
+        writer.writeWString(product.name);
+        writer.writeWString(Dictionary::get(product.category));
+        writer.writeWString(product.price);
+    }
+
+    Product ReadProduct(SnapshotReader &reader)
+    {
+        Product product;
+        product.sku = reader.readWString();
+        product.name = reader.readWString();
+        product.category = categories.intern(reader.readWString());
+        product.price = reader.readWString();
+        UpdateSortKey(product);
+        return product;
+    }
+
+    // Posisi terakhir CSV yang sudah dimuat, digunakan oleh DoLoadAppended
+    CSVReaderCheckpoint checkpoint;
+    // Baris CSV yang formatnya salah pada pemuatan terakhir, dilewati tanpa membatalkan pemuatan
+    std::vector<CSVQuarantinedRow> quarantine;
+
+    bool LoadSnapshot(const SnapshotSource &source)
+    {
+        if (!LoadTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, ReadProduct))
+            return false;
+
+        hashTable.reserve(tree.count);
+        tree.inorder(tree.root, [&](RBNode<Product> *node)
+                     { hashTable.put(node->value.sku, node->value); });
+
+        // Snapshot berisi seluruh isi CSV sebesar source.size
+        CSVReader<CSVReaderIOMapped> reader(csvPath, ';');
+        reader.startRead();
+        char *dataBegin = reader.io.cursor;
+        reader.io.cursor = reader.io.begin + std::min<size_t>(source.size, reader.io.end - reader.io.begin);
+        reader.line += std::count(dataBegin, reader.io.cursor, '\n');
+        checkpoint = reader.checkpoint();
+        return true;
+    }
+
+    template <typename Consume>
+    void ReadProducts(CSVReader<CSVReaderIOMapped> &reader, Consume consume)
+    {
+        reader.projection = true;
+        reader.lenient = true;
+
+        int skuIndex = reader.findHeaderIndex("sku");
+        int nameIndex = reader.findHeaderIndex("name");
+        int categoryIndex = reader.findHeaderIndex("category");
+        int priceIndex = reader.findHeaderIndex("price");
+
+        // Kategori disimpan sebagai byte UTF-8 dan dimasukkan ke kamus di thread pemanggil
+        // Kategori pendek muat di small string buffer sehingga tidak perlu alokasi
+        struct ProductRow
+        {
+            Product product;
+            std::string category;
+        };
+
+        reader.readParallel<ProductRow>(
+            std::thread::hardware_concurrency(),
+            [&](const std::vector<Utils::StringView> &data)
+            {
+                ProductRow row;
+                Utils::stringviewsToWstrings(data, {{skuIndex, &row.product.sku},
+                                                    {nameIndex, &row.product.name},
+                                                    {priceIndex, &row.product.price}});
+                row.category.assign(data[categoryIndex].begin, data[categoryIndex].size);
+                // Kunci urutan dihitung di thread parser, bukan di thread yang membangun tree
+                UpdateSortKey(row.product);
+                return row;
+            },
+            [&](ProductRow &&row)
+            {
+                row.product.category = categories.internUtf8(row.category);
+                consume(std::move(row.product));
+            });
+
+        checkpoint = reader.checkpoint();
+        quarantine = std::move(reader.quarantine);
+    }
+
+    // Keterangan baris yang dilewati untuk status bar, kosong jika tidak ada
+    std::wstring QuarantineStr()
+    {
+        if (quarantine.empty())
+            return L"";
+
+        return L", " + std::to_wstring(quarantine.size()) + L" baris dilewati (baris " +
+               std::to_wstring(quarantine.front().line) + L": " +
+               std::wstring(quarantine.front().message.begin(), quarantine.front().message.end()) + L")";
+    }
+
     void DoLoad()
     {
 
         progressBar.SetWaiting(true);
 
         Timer timer;
+        SnapshotSource source;
+        bool hasSource = source.read(csvPath);
+
+        statusBar.SetText(1, L"Memuat data dari snapshot");
+        timer.start();
+        if (hasSource && LoadSnapshot(source))
+        {
+            timer.end();
+            progressBar.SetWaiting(false);
+            statusBar.SetText(1, L"Data dimuat dari snapshot dalam " + timer.durationStr());
+            return;
+        }
+
         statusBar.SetText(1, L"Memuat data dari CSV");
 
         {
             timer.start();
-            CSVReader<CSVReaderIOBuffSync> reader("data/products.csv", ';');
+            CSVReader<CSVReaderIOMapped> reader(csvPath, ';');
             reader.startRead();
 
-            int skuIndex = reader.findHeaderIndex("sku");
-            int nameIndex = reader.findHeaderIndex("name");
-            int categoryIndex = reader.findHeaderIndex("category");
-            int priceIndex = reader.findHeaderIndex("price");
-
-            while (reader.readData())
-            {
-                Product product{
-                    Utils::stringviewToWstring(reader.data[skuIndex]),
-                    Utils::stringviewToWstring(reader.data[nameIndex]),
-                    Utils::stringviewToWstring(reader.data[categoryIndex]),
-                    Utils::stringviewToWstring(reader.data[priceIndex])};
-                hashTable.put(product.sku, product);
-                tree.insert(std::move(product));
-            }
+            // Tree dibangun sekaligus setelah seluruh baris dibaca
+            std::vector<Product> products;
+            ReadProducts(reader, [&](Product &&product)
+                         {
+                             hashTable.put(product.sku, product);
+                             products.push_back(std::move(product));
+                         });
+            tree.insertBulk(std::move(products));
             timer.end();
         }
+
+        // Snapshot hanya untuk mempercepat pemuatan berikutnya, kegagalan menulis tidak mengganggu aplikasi
+        try
+        {
+            if (hasSource)
+                SaveTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, WriteProduct);
+        }
+        catch (const std::domain_error &)
+        {
+        }
         progressBar.SetWaiting(false);
 
-        statusBar.SetText(1, L"Data dimuat dari CSV dalam " + timer.durationStr());
+        statusBar.SetText(1, L"Data dimuat dari CSV dalam " + timer.durationStr() + QuarantineStr());
+    }
+
+    /**
+     * Memuat hanya baris yang ditambahkan di akhir CSV sejak pemuatan terakhir
+     * Produk dengan SKU yang sudah ada diganti dengan data baru
+     * Jika CSV dipotong atau ditulis ulang, seluruh data dimuat ulang
+     */
+    void DoLoadAppended()
+    {
+        // Dikosongkan di dalam tugas tulis agar refresh yang sudah antri tidak menampilkan tree yang sedang diubah
+        ClearAllList();
+        progressBar.SetWaiting(true);
+        statusBar.SetText(1, L"Memuat data baru dari CSV");
+
+        Timer timer;
+        timer.start();
+
+        CSVReader<CSVReaderIOMapped> reader(csvPath, ';');
+        if (!reader.resume(checkpoint))
+        {
+            tree.clear();
+            hashTable.clear();
+            DoLoad();
+            return;
+        }
+
+        size_t count = 0;
+        ReadProducts(reader, [&](Product &&product)
+                     {
+                         Product *old = hashTable.get(product.sku);
+                         if (old != nullptr)
+                             tree.remove(*old);
+
+                         hashTable.put(product.sku, product);
+                         tree.insert(std::move(product));
+                         count++;
+                     });
+        timer.end();
+
+        progressBar.SetWaiting(false);
+        statusBar.SetText(1, std::to_wstring(count) + L" data baru dimuat dalam " + timer.durationStr() + QuarantineStr());
     }
 
     LRESULT OnClose(UI::CallbackParam param)
@@ -1120,6 +1483,13 @@ void ClearAllList()
     TabAllProducts::listView.SetRowCount(0);
     TabFindProductsRange::listView.SetRowCount(0);
     TabCheapProducts::listView.SetRowCount(0);
+    TabHistoryDelete::listView.SetRowCount(0);
+}
+
+void EnqueueLoadAppended()
+{
+    WorkerThread::EnqueueWork(MainWindow::DoLoadAppended);
+    EnqueueRefreshAll(nullptr);
 }
 
 void EnqueueRefreshAll(UI::Window *callerWindow)
@@ -9,6 +9,7 @@
 #include "WorkerThread.hpp"
 #include "TopKLargest.hpp"
 #include "UIUtils.hpp"
+#include "Snapshot.hpp"
 #include <stdlib.h>
 
 struct Book
@@ -18,21 +19,32 @@ struct Book
     std::wstring author;
     std::wstring publisher;
     int year;
+    // Kunci urutan judul lalu ISBN, diisi UpdateSortKey setiap judul atau ISBN berubah
+    std::string sortKey;
 };
 
+void UpdateSortKey(Book &book)
+{
+    book.sortKey = Utils::SortKey(book.title, book.isbn);
+}
+
+// Sama dengan CompareWStringHalfInsensitive judul lalu ISBN, melalui kunci urutan
 struct BookTitleComparer
 {
     int compare(const Book &a, const Book &b)
     {
-        int compare = Utils::CompareWStringHalfInsensitive(a.title, b.title);
-
-        if (compare != 0)
-            return compare;
-
-        return Utils::CompareWStringHalfInsensitive(a.isbn, b.isbn);
+        return Utils::CompareSortKey(a.sortKey, b.sortKey);
     }
 };
 
+// Buku batas untuk pencarian rentang judul
+Book BookBound(const std::wstring &isbn, const std::wstring &title)
+{
+    Book book{isbn, title};
+    UpdateSortKey(book);
+    return book;
+}
+
 struct BookYearCompareReversed
 {
     int compare(Book *a, Book *b)
@@ -55,6 +67,12 @@ struct BookTitleHasher
     }
 };
 
+// Kunci hash table untuk putMany dan removeMany
+const std::wstring &BookISBN(const Book &book)
+{
+    return book.isbn;
+}
+
 RBTree<Book, BookTitleComparer> tree;
 RobinHoodHashMap<std::wstring, Book, BookTitleHasher> hashTable;
 RBTree<Book, BookTitleComparer> removeHistoryTree;
@@ -85,7 +103,11 @@ namespace AddWindow
     {
         Timer t;
 
+        // List yang mengambil baris langsung dari tree tidak boleh dibaca saat tree diubah
+        ClearAllList();
+
         t.start();
+        UpdateSortKey(book);
         hashTable.put(book.isbn, book);
         tree.insert(std::move(book));
         t.end();
@@ -217,8 +239,15 @@ namespace AddWindow
     }
 }
 
+/**
+ * Baris diambil langsung dari tree dengan select jika tree diisi (urutan inorder mulai dari treeFirst),
+ * sehingga tidak perlu menyalin pointer seluruh node setiap kali refresh
+ * Urutan lain (preorder, postorder, top K) tetap disalin ke items
+ */
 struct BookListView : UI::VListView
 {
+    RBTree<Book, BookTitleComparer> *tree = nullptr;
+    size_t treeFirst = 0;
     std::vector<Book *> items;
 
     void Create(UI::Window *window, HWND hParent, POINT pos, SIZE size) override
@@ -234,9 +263,34 @@ struct BookListView : UI::VListView
         InsertColumn(L"Tahun", 100);
     }
 
+    Book *GetItem(int row)
+    {
+        if (tree != nullptr)
+            return &tree->select(treeFirst + row)->value;
+        return items[row];
+    }
+
+    // Menampilkan count nilai dari source mulai dari index first (inorder)
+    void ShowTree(RBTree<Book, BookTitleComparer> *source, size_t first, size_t count)
+    {
+        SetRowCount(0);
+        std::vector<Book *>().swap(items);
+        tree = source;
+        treeFirst = first;
+        SetRowCount(count);
+    }
+
+    // Menampilkan isi items
+    void ShowItems()
+    {
+        SetRowCount(0);
+        tree = nullptr;
+        SetRowCount(items.size());
+    }
+
     const std::wstring OnGetItem(int row, int column) override
     {
-        Book *book = items[row];
+        Book *book = GetItem(row);
         if (column == 0)
             return book->isbn;
         else if (column == 1)
@@ -269,13 +323,15 @@ namespace TabHistoryDelete
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         progress.SetWaiting(true);
         message.ReplaceLastMessage(L"Memuat data");
 
         std::wstring type = combobox.GetSelectedText();
-        listView.items.resize(removeHistoryTree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -283,25 +339,31 @@ namespace TabHistoryDelete
         {
             timer.start();
 
-            size_t current = 0;
-            std::function<void(RBNode<Book> *)> visitor = [&](RBNode<Book> *node)
+            if (type == L"In-order")
             {
-                listView.items[current] = &node->value;
-                current++;
-            };
-
-            if (type == L"Pre-order")
-                removeHistoryTree.preorder(removeHistoryTree.root, visitor);
-            else if (type == L"In-order")
-                removeHistoryTree.inorder(removeHistoryTree.root, visitor);
-            else if (type == L"Post-order")
-                removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowTree(&removeHistoryTree, 0, removeHistoryTree.count);
+            }
+            else
+            {
+                listView.items.resize(removeHistoryTree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Book> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+
+                if (type == L"Pre-order")
+                    removeHistoryTree.preorder(removeHistoryTree.root, visitor);
+                else if (type == L"Post-order")
+                    removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowItems();
+            }
 
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(removeHistoryTree.count);
 
         message.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
         SetEnable(true);
@@ -311,7 +373,7 @@ namespace TabHistoryDelete
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -328,21 +390,18 @@ namespace TabHistoryDelete
         std::vector<Book> books;
         for (int v : listView.GetSelectedIndex())
         {
-            books.push_back(*listView.items[v]);
+            books.push_back(*listView.GetItem(v));
         }
 
-        listView.SetRowCount(0);
+        ClearAllList();
 
         Timer t;
 
         t.start();
-        for (Book &book : books)
-        {
-            removeHistoryTree.remove(book);
-
-            hashTable.put(book.isbn, book);
-            tree.insert(std::move(book));
-        }
+        // Seluruh data yang dipilih diproses sekaligus di setiap struktur
+        removeHistoryTree.removeMany(books);
+        hashTable.putMany(books, BookISBN);
+        tree.insertBulk(std::move(books));
         t.end();
 
         progress.SetWaiting(false);
@@ -355,7 +414,7 @@ namespace TabHistoryDelete
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoRestore);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -411,6 +470,36 @@ void DoRemove(Book &&book, HWND window)
     removeHistoryTree.insert(std::move(book));
 }
 
+/**
+ * Menghapus banyak data sekaligus: setiap struktur diproses sekali untuk seluruh data
+ * Tree disusun ulang sekali dan hash table diperkecil sekali, bukan setiap data
+ */
+void DoRemoveMany(std::vector<Book> &&books, HWND window)
+{
+    if (tree.removeMany(books) != books.size())
+        MessageBoxA(window, "Penghapusan di RBTree gagal", "Gagal", MB_OK);
+
+    if (hashTable.removeMany(books, BookISBN) != books.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(books));
+}
+
+/**
+ * Menghapus seluruh data dalam rentang tree sekaligus
+ * Rentang dilepas dari tree dengan split dan join tanpa menghapus node satu per satu,
+ * lalu data yang dilepas dihapus dari hash table dan dimasukkan ke riwayat sekaligus
+ */
+void DoRemoveRange(RBTree<Book, BookTitleComparer>::Range range, HWND window)
+{
+    std::vector<Book> books = tree.extractRange(range.begin(), range.end());
+
+    if (hashTable.removeMany(books, BookISBN) != books.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(books));
+}
+
 void DoRemoveByListViewSelection(BookListView *listView, UI::ProgressBar *progress, UI::LabelWorkMessage *message)
 {
     progress->SetWaiting(true);
@@ -419,7 +508,7 @@ void DoRemoveByListViewSelection(BookListView *listView, UI::ProgressBar *progre
     std::vector<Book> selectedBook;
     for (int v : listView->GetSelectedIndex())
     {
-        selectedBook.push_back(*listView->items[v]);
+        selectedBook.push_back(*listView->GetItem(v));
     }
 
     ClearAllList();
@@ -427,10 +516,7 @@ void DoRemoveByListViewSelection(BookListView *listView, UI::ProgressBar *progre
     Timer t;
 
     t.start();
-    for (Book &buku : selectedBook)
-    {
-        DoRemove(std::move(buku), listView->_window->hwnd);
-    }
+    DoRemoveMany(std::move(selectedBook), listView->_window->hwnd);
     t.end();
 
     message->ReplaceLastMessage(L"Penghapusan selesai dalam " + t.durationStr() + L". Penghapusan mungkin terlihat lama karena proses mendapatkan pilihan dari UI");
@@ -481,6 +567,9 @@ namespace TabOldBooks
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Memproses data");
@@ -507,7 +596,7 @@ namespace TabOldBooks
         }
         timer.end();
 
-        listView.SetRowCount(listSize);
+        listView.ShowItems();
         progress.SetWaiting(false);
         message.ReplaceLastMessage(L"Data ditemukan dalam " + timer.durationStr());
         SetEnable(true);
@@ -517,7 +606,7 @@ namespace TabOldBooks
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam param)
@@ -536,7 +625,7 @@ namespace TabOldBooks
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -600,7 +689,7 @@ namespace TabFindBooksRange
     UI::Label fromLabel, toLabel;
     UI::TextBox fromTextBox, toTextBox;
     UI::Button btnFind;
-    UI::Button btnAdd, btnDelete, btnCopyISBN;
+    UI::Button btnAdd, btnDelete, btnDeleteRange, btnCopyISBN;
     UI::ProgressBar progress;
     UI::LabelWorkMessage label;
     BookListView listView;
@@ -612,13 +701,41 @@ namespace TabFindBooksRange
         btnFind.SetEnable(enable);
         btnAdd.SetEnable(enable);
         btnDelete.SetEnable(enable);
+        btnDeleteRange.SetEnable(enable);
         btnCopyISBN.SetEnable(enable);
         listView.SetEnable(enable);
     }
 
+    // Rentang yang ditampilkan dan dihapus tab ini, batasnya dicari dalam O(log n)
+    RBTree<Book, BookTitleComparer>::Range FindRange(const std::wstring &from, const std::wstring &to)
+    {
+        if (to.empty())
+        {
+            // Batas akhir kosong: semua data dengan judul berawalan batas awal
+            return tree.prefixRange(BookBound(L".", from), [&](const Book &value)
+                                    { return Utils::StartsWith(value.title, from); });
+        }
+
+        return {tree.lowerBound(BookBound(L".", from)), tree.upperBound(BookBound(L":", to))};
+    }
+
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
+    // Batas dan jumlah hasil yang terakhir ditampilkan
+    // "Hapus Semua Hasil" menghapus rentang ini, bukan isi text box saat tombol ditekan
+    struct ShownRange
+    {
+        std::wstring from, to;
+        size_t count;
+        // WorkerThread::WriteVersion saat hasil ditampilkan
+        uint64_t version;
+    };
+    // Ditulis DoRefresh di thread pool baca dan dibaca thread UI
+    WorkerThread::Published<ShownRange> shown;
+
     void DoRefresh()
     {
-        listView.items.clear();
         listView.SetRowCount(0);
 
         label.ReplaceLastMessage(L"Menemukan data");
@@ -628,14 +745,17 @@ namespace TabFindBooksRange
         progress.SetWaiting(true);
 
         {
+            // Index batas rentang dicari dengan indexOf, baris diambil dari tree saat ditampilkan
             timer.start();
-            tree.findBetween(Book{L".", from}, {L":", to}, [&](RBNode<Book> *node)
-                             { listView.items.push_back(&node->value); });
+            auto range = FindRange(from, to);
+            size_t first = tree.indexOf(range.begin());
+            size_t last = tree.indexOf(range.end());
             timer.end();
+            listView.ShowTree(&tree, first, last > first ? last - first : 0);
+            shown.Set({from, to, last > first ? last - first : 0, WorkerThread::WriteVersion()});
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data ditemukan dalam dalam " + timer.durationStr());
         progress.SetWaiting(false);
@@ -647,7 +767,7 @@ namespace TabFindBooksRange
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam param)
@@ -666,7 +786,57 @@ namespace TabFindBooksRange
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
+        EnqueueRefreshAll(&window);
+        return 0;
+    }
+
+    // Menghapus seluruh hasil pencarian rentang, bukan hanya yang dipilih
+    void DoDeleteRange(const ShownRange &range)
+    {
+        progress.SetWaiting(true);
+        label.ReplaceLastMessage(L"Menghapus rentang");
+
+        // Hanya rentang yang dikonfirmasi yang dihapus, batal jika data berubah setelah hasil ditampilkan
+        auto current = FindRange(range.from, range.to);
+        size_t first = tree.indexOf(current.begin());
+        size_t last = tree.indexOf(current.end());
+        if (range.version != WorkerThread::WriteVersion() || (last > first ? last - first : 0) != range.count)
+        {
+            label.ReplaceLastMessage(L"Data berubah setelah hasil ditampilkan, tidak ada data yang dihapus");
+            UIUtils::MessageSetWait(&label, false);
+            progress.SetWaiting(false);
+            return;
+        }
+
+        ClearAllList();
+
+        Timer timer;
+        timer.start();
+        DoRemoveRange(current, window.hwnd);
+        timer.end();
+
+        label.ReplaceLastMessage(L"Penghapusan rentang selesai dalam " + timer.durationStr());
+        UIUtils::MessageSetWait(&label, false);
+        progress.SetWaiting(false);
+    }
+
+    LRESULT OnDeleteRangeClick(UI::CallbackParam param)
+    {
+        ShownRange range = shown.Get();
+        if (range.count == 0)
+            return 0;
+
+        std::wstring confirm = L"Hapus " + std::to_wstring(range.count) + L" data hasil pencarian? Data dapat dikembalikan dari riwayat penghapusan.";
+        if (MessageBoxW(window.hwnd, confirm.c_str(), L"Hapus Semua Hasil", MB_OKCANCEL | MB_ICONWARNING) != IDOK)
+            return 0;
+
+        // Rentang disalin ke tugas karena refresh berikutnya dapat mengganti rentang yang ditampilkan sebelum tugas berjalan
+        UIUtils::MessageSetWait(&label);
+        SetEnable(false);
+        WorkerThread::EnqueueWork([range]()
+                                  { DoDeleteRange(range); });
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -694,6 +864,9 @@ namespace TabFindBooksRange
         btnDelete.SetText(L"Hapus Buku");
         btnDelete.commandListener = OnDeleteClick;
 
+        btnDeleteRange.SetText(L"Hapus Semua Hasil");
+        btnDeleteRange.commandListener = OnDeleteRangeClick;
+
         window.controlsLayout = {
             {UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &fromLabel),
              UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &fromTextBox),
@@ -706,7 +879,8 @@ namespace TabFindBooksRange
             {UI::EmptyCell(UI::SIZE_FILL, UI::SIZE_DEFAULT),
              UI::ControlCell(100, UI::SIZE_DEFAULT, &btnCopyISBN),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnAdd),
-             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete)}};
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete),
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDeleteRange)}};
 
         UI::LayoutControls(&window, true);
 
@@ -742,11 +916,13 @@ namespace TabAllBooks
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         std::wstring type = combobox.GetSelectedText();
 
-        listView.items.resize(tree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -756,23 +932,30 @@ namespace TabAllBooks
 
         {
             timer.start();
-            size_t current = 0;
-            std::function<void(RBNode<Book> *)> visitor = [&](RBNode<Book> *node)
-            {
-                listView.items[current] = &node->value;
-                current++;
-            };
             if (type == L"In-order")
-                tree.inorder(tree.root, visitor);
-            else if (type == L"Pre-order")
-                tree.preorder(tree.root, visitor);
-            else if (type == L"Post-order")
-                tree.postorder(tree.root, visitor);
+            {
+                listView.ShowTree(&tree, 0, tree.count);
+            }
+            else
+            {
+                listView.items.resize(tree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Book> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+
+                if (type == L"Pre-order")
+                    tree.preorder(tree.root, visitor);
+                else if (type == L"Post-order")
+                    tree.postorder(tree.root, visitor);
+                listView.ShowItems();
+            }
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
 
@@ -783,7 +966,7 @@ namespace TabAllBooks
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -802,7 +985,7 @@ namespace TabAllBooks
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -875,6 +1058,9 @@ namespace TabDetailsBooks
         btnDelete.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         label.ReplaceLastMessage(L"Mencari buku sesuai dengan ISBN");
@@ -909,7 +1095,7 @@ namespace TabDetailsBooks
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam)
@@ -940,7 +1126,7 @@ namespace TabDetailsBooks
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
 
         return 0;
@@ -997,18 +1183,84 @@ namespace MainWindow
     UI::StatusBar statusBar;
     UI::ProgressBar progressBar;
 
+    const std::string csvPath = "data/books.csv";
+    const std::string snapshotPath = "data/books.snapshot";
+    // Naikkan jika isi Book atau BookTitleComparer berubah
+    const uint32_t snapshotRecordVersion = 1;
+
+    void WriteBook(SnapshotWriter &writer, const Book &book)
+    {
+        writer.writeWString(book.isbn);
+        writer.writeWString(book.title);
+        writer.writeWString(book.author);
+        writer.writeWString(book.publisher);
+        writer.writePod(book.year);
+    }
+
+    Book ReadBook(SnapshotReader &reader)
+    {
+        Book book;
+        book.isbn = reader.readWString();
+        book.title = reader.readWString();
+        book.author = reader.readWString();
+        book.publisher = reader.readWString();
+        book.year = reader.readPod<int>();
+        UpdateSortKey(book);
+        return book;
+    }
+
+    // Baris CSV yang formatnya salah pada pemuatan terakhir, dilewati tanpa membatalkan pemuatan
+    std::vector<CSVQuarantinedRow> quarantine;
+
+    // Keterangan baris yang dilewati untuk status bar, kosong jika tidak ada
+    std::wstring QuarantineStr()
+    {
+        if (quarantine.empty())
+            return L"";
+
+        return L", " + std::to_wstring(quarantine.size()) + L" baris dilewati (baris " +
+               std::to_wstring(quarantine.front().line) + L": " +
+               std::wstring(quarantine.front().message.begin(), quarantine.front().message.end()) + L")";
+    }
+
+    bool LoadSnapshot(const SnapshotSource &source)
+    {
+        if (!LoadTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, ReadBook))
+            return false;
+
+        hashTable.reserve(tree.count);
+        tree.inorder(tree.root, [&](RBNode<Book> *node)
+                     { hashTable.put(node->value.isbn, node->value); });
+        return true;
+    }
+
     void DoLoad()
     {
 
         progressBar.SetWaiting(true);
 
         Timer timer;
+        SnapshotSource source;
+        bool hasSource = source.read(csvPath);
+
+        statusBar.SetText(1, L"Memuat data dari snapshot");
+        timer.start();
+        if (hasSource && LoadSnapshot(source))
+        {
+            timer.end();
+            progressBar.SetWaiting(false);
+            statusBar.SetText(1, L"Data dimuat dari snapshot dalam " + timer.durationStr());
+            return;
+        }
+
         statusBar.SetText(1, L"Memuat data dari CSV");
 
         {
             timer.start();
-            CSVReader<CSVReaderIOBuffSync> reader("data/books.csv", ';');
+            CSVReader<CSVReaderIOMapped> reader(csvPath, ';');
             reader.startRead();
+            reader.projection = true;
+            reader.lenient = true;
 
             int isbnIndex = reader.findHeaderIndex("ISBN");
             int titleIndex = reader.findHeaderIndex("Book-Title");
@@ -1016,22 +1268,43 @@ namespace MainWindow
             int publisherIndex = reader.findHeaderIndex("Publisher");
             int yearIndex = reader.findHeaderIndex("Year-Of-Publication");
 
-            while (reader.readData())
-            {
-                Book book{
-                    Utils::stringviewToWstring(reader.data[isbnIndex]),
-                    Utils::stringviewToWstring(reader.data[titleIndex]),
-                    Utils::stringviewToWstring(reader.data[authorIndex]),
-                    Utils::stringviewToWstring(reader.data[publisherIndex]),
-                    std::stoi(Utils::stringviewToWstring(reader.data[yearIndex]))};
-                hashTable.put(book.isbn, book);
-                tree.insert(std::move(book));
-            }
+            // Tree dibangun sekaligus setelah seluruh baris dibaca
+            std::vector<Book> books;
+            reader.readParallel<Book>(
+                std::thread::hardware_concurrency(),
+                [&](const std::vector<Utils::StringView> &data)
+                {
+                    Book book;
+                    Utils::stringviewsToWstrings(data, {{isbnIndex, &book.isbn},
+                                                        {titleIndex, &book.title},
+                                                        {authorIndex, &book.author},
+                                                        {publisherIndex, &book.publisher}});
+                    book.year = CSVField::toInt(data, yearIndex);
+                    UpdateSortKey(book);
+                    return book;
+                },
+                [&](Book &&book)
+                {
+                    hashTable.put(book.isbn, book);
+                    books.push_back(std::move(book));
+                });
+            tree.insertBulk(std::move(books));
+            quarantine = std::move(reader.quarantine);
             timer.end();
         }
+
+        // Snapshot hanya untuk mempercepat pemuatan berikutnya, kegagalan menulis tidak mengganggu aplikasi
+        try
+        {
+            if (hasSource)
+                SaveTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, WriteBook);
+        }
+        catch (const std::domain_error &)
+        {
+        }
         progressBar.SetWaiting(false);
 
-        statusBar.SetText(1, L"Data dimuat dari CSV dalam " + timer.durationStr());
+        statusBar.SetText(1, L"Data dimuat dari CSV dalam " + timer.durationStr() + QuarantineStr());
     }
 
     LRESULT OnClose(UI::CallbackParam param)
@@ -1106,6 +1379,7 @@ void ClearAllList()
     TabAllBooks::listView.SetRowCount(0);
     TabFindBooksRange::listView.SetRowCount(0);
     TabOldBooks::listView.SetRowCount(0);
+    TabHistoryDelete::listView.SetRowCount(0);
 }
 
 void EnqueueRefreshAll(UI::Window *callerWindow)
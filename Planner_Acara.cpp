@@ -8,33 +8,47 @@
 #include "unordered_map"
 #include "WorkerThread.hpp"
 #include "TopKLargest.hpp"
+#include "Snapshot.hpp"
+#include "Dictionary.hpp"
 #include <stdlib.h>
 
 struct Event
 {
     std::wstring id;
     std::wstring name;
-    std::wstring location;
-    std::wstring country;
-    std::wstring genre;
+    // Kode dari kamus locations, countries, dan genres
+    DictionaryCode location;
+    DictionaryCode country;
+    DictionaryCode genre;
     int visitor;
     SYSTEMTIME date;
     std::wstring description;
+    // Kunci urutan nama lalu ID, diisi UpdateSortKey setiap nama atau ID berubah
+    std::string sortKey;
 };
 
+void UpdateSortKey(Event &event)
+{
+    event.sortKey = Utils::SortKey(event.name, event.id);
+}
+
+// Sama dengan CompareWStringHalfInsensitive nama lalu ID, melalui kunci urutan
 struct EventNameComparer
 {
     int compare(const Event &a, const Event &b)
     {
-        int compare = Utils::CompareWStringHalfInsensitive(a.name, b.name);
-
-        if (compare != 0)
-            return compare;
-
-        return Utils::CompareWStringHalfInsensitive(a.id, b.id);
+        return Utils::CompareSortKey(a.sortKey, b.sortKey);
     }
 };
 
+// Event batas untuk pencarian rentang nama
+Event EventBound(const std::wstring &id, const std::wstring &name)
+{
+    Event event{id, name};
+    UpdateSortKey(event);
+    return event;
+}
+
 struct EventDateCompareReversed
 {
     int compare(Event *a, Event *b)
@@ -59,8 +73,15 @@ struct EventNameHasher
     }
 };
 
+// Kunci hash table untuk putMany dan removeMany
+const std::wstring &EventID(const Event &event)
+{
+    return event.id;
+}
+
 RBTree<Event, EventNameComparer> tree;
 RobinHoodHashMap<std::wstring, Event, EventNameHasher> hashTable;
+Dictionary locations, countries, genres;
 RBTree<Event, EventNameComparer> removeHistoryTree;
 
 void ClearAllList();
@@ -90,12 +111,20 @@ namespace AddWindow
     UI::DateTimePicker dtpTanggal;
     UI::Button btnAdd;
     Event event;
+    std::wstring location, country, genre;
 
     void DoAdd()
     {
         Timer t;
 
+        // List yang mengambil baris langsung dari tree tidak boleh dibaca saat tree diubah
+        ClearAllList();
+
         t.start();
+        event.location = locations.intern(location);
+        event.country = countries.intern(country);
+        event.genre = genres.intern(genre);
+        UpdateSortKey(event);
         hashTable.put(event.id, event);
         tree.insert(std::move(event));
         t.end();
@@ -111,12 +140,15 @@ namespace AddWindow
         event = Event{
             idTextBox.getText(),
             namaTextBox.getText(),
-            lokasiTextBox.getText(),
-            negaraTextBox.getText(),
-            aliranTextBox.getText(),
+            nullptr,
+            nullptr,
+            nullptr,
             kapasitas.first,
             dtpTanggal.GetValue(),
             deskripsiTextBox.getText()};
+        location = lokasiTextBox.getText();
+        country = negaraTextBox.getText();
+        genre = aliranTextBox.getText();
 
         try
         {
@@ -144,15 +176,15 @@ namespace AddWindow
             {
                 throw std::domain_error("Nama Event Tidak Boleh Kosong");
             }
-            if (event.location.size() == 0)
+            if (location.size() == 0)
             {
                 throw std::domain_error("Lokasi Event Tidak Boleh Kosong");
             }
-            if (event.country.size() == 0)
+            if (country.size() == 0)
             {
                 throw std::domain_error("Negara Event Tidak Boleh Kosong");
             }
-            if (event.genre.size() == 0)
+            if (genre.size() == 0)
             {
                 throw std::domain_error("Genre Musik Event Tidak Boleh Kosong");
             }
@@ -236,8 +268,15 @@ namespace AddWindow
     }
 }
 
+/**
+ * Baris diambil langsung dari tree dengan select jika tree diisi (urutan inorder mulai dari treeFirst),
+ * sehingga tidak perlu menyalin pointer seluruh node setiap kali refresh
+ * Urutan lain (preorder, postorder, top K) tetap disalin ke items
+ */
 struct EventListView : UI::VListView
 {
+    RBTree<Event, EventNameComparer> *tree = nullptr;
+    size_t treeFirst = 0;
     std::vector<Event *> items;
 
     void Create(UI::Window *window, HWND hParent, POINT pos, SIZE size) override
@@ -256,19 +295,44 @@ struct EventListView : UI::VListView
         InsertColumn(L"Deskripsi Event", 100);
     }
 
+    Event *GetItem(int row)
+    {
+        if (tree != nullptr)
+            return &tree->select(treeFirst + row)->value;
+        return items[row];
+    }
+
+    // Menampilkan count nilai dari source mulai dari index first (inorder)
+    void ShowTree(RBTree<Event, EventNameComparer> *source, size_t first, size_t count)
+    {
+        SetRowCount(0);
+        std::vector<Event *>().swap(items);
+        tree = source;
+        treeFirst = first;
+        SetRowCount(count);
+    }
+
+    // Menampilkan isi items
+    void ShowItems()
+    {
+        SetRowCount(0);
+        tree = nullptr;
+        SetRowCount(items.size());
+    }
+
     const std::wstring OnGetItem(int row, int column) override
     {
-        Event *event = items[row];
+        Event *event = GetItem(row);
         if (column == 0)
             return event->id;
         else if (column == 1)
             return event->name;
         else if (column == 2)
-            return event->location;
+            return Dictionary::get(event->location);
         else if (column == 3)
-            return event->country;
+            return Dictionary::get(event->country);
         else if (column == 4)
-            return event->genre;
+            return Dictionary::get(event->genre);
         else if (column == 5)
             return std::to_wstring(event->visitor);
         else if (column == 6)
@@ -304,13 +368,15 @@ namespace TabHistoryDelete
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         progress.SetWaiting(true);
         message.ReplaceLastMessage(L"Memuat data");
 
         std::wstring type = combobox.GetSelectedText();
-        listView.items.resize(removeHistoryTree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -318,25 +384,31 @@ namespace TabHistoryDelete
         {
             timer.start();
 
-            size_t current = 0;
-            std::function<void(RBNode<Event> *)> visitor = [&](RBNode<Event> *node)
+            if (type == L"In-order")
             {
-                listView.items[current] = &node->value;
-                current++;
-            };
-
-            if (type == L"Pre-order")
-                removeHistoryTree.preorder(removeHistoryTree.root, visitor);
-            else if (type == L"In-order")
-                removeHistoryTree.inorder(removeHistoryTree.root, visitor);
-            else if (type == L"Post-order")
-                removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowTree(&removeHistoryTree, 0, removeHistoryTree.count);
+            }
+            else
+            {
+                listView.items.resize(removeHistoryTree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Event> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+
+                if (type == L"Pre-order")
+                    removeHistoryTree.preorder(removeHistoryTree.root, visitor);
+                else if (type == L"Post-order")
+                    removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowItems();
+            }
 
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(removeHistoryTree.count);
 
         message.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
         SetEnable(true);
@@ -346,7 +418,7 @@ namespace TabHistoryDelete
     {
         MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -363,21 +435,18 @@ namespace TabHistoryDelete
         std::vector<Event> events;
         for (int v : listView.GetSelectedIndex())
         {
-            events.push_back(*listView.items[v]);
+            events.push_back(*listView.GetItem(v));
         }
 
-        listView.SetRowCount(0);
+        ClearAllList();
 
         Timer t;
 
         t.start();
-        for (Event &event : events)
-        {
-            removeHistoryTree.remove(event);
-
-            hashTable.put(event.id, event);
-            tree.insert(std::move(event));
-        }
+        // Seluruh data yang dipilih diproses sekaligus di setiap struktur
+        removeHistoryTree.removeMany(events);
+        hashTable.putMany(events, EventID);
+        tree.insertBulk(std::move(events));
         t.end();
 
         progress.SetWaiting(false);
@@ -390,7 +459,7 @@ namespace TabHistoryDelete
         MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoRestore);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -446,6 +515,36 @@ void DoRemove(Event &&event, HWND window)
     removeHistoryTree.insert(std::move(event));
 }
 
+/**
+ * Menghapus banyak data sekaligus: setiap struktur diproses sekali untuk seluruh data
+ * Tree disusun ulang sekali dan hash table diperkecil sekali, bukan setiap data
+ */
+void DoRemoveMany(std::vector<Event> &&events, HWND window)
+{
+    if (tree.removeMany(events) != events.size())
+        MessageBoxA(window, "Penghapusan di RBTree gagal", "Gagal", MB_OK);
+
+    if (hashTable.removeMany(events, EventID) != events.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(events));
+}
+
+/**
+ * Menghapus seluruh data dalam rentang tree sekaligus
+ * Rentang dilepas dari tree dengan split dan join tanpa menghapus node satu per satu,
+ * lalu data yang dilepas dihapus dari hash table dan dimasukkan ke riwayat sekaligus
+ */
+void DoRemoveRange(RBTree<Event, EventNameComparer>::Range range, HWND window)
+{
+    std::vector<Event> events = tree.extractRange(range.begin(), range.end());
+
+    if (hashTable.removeMany(events, EventID) != events.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(events));
+}
+
 void DoRemoveByListViewSelection(EventListView *listView, UI::ProgressBar *progress, UI::LabelWorkMessage *message)
 {
     progress->SetWaiting(true);
@@ -454,7 +553,7 @@ void DoRemoveByListViewSelection(EventListView *listView, UI::ProgressBar *progr
     std::vector<Event> selectedEvent;
     for (int v : listView->GetSelectedIndex())
     {
-        selectedEvent.push_back(*listView->items[v]);
+        selectedEvent.push_back(*listView->GetItem(v));
     }
 
     ClearAllList();
@@ -462,10 +561,7 @@ void DoRemoveByListViewSelection(EventListView *listView, UI::ProgressBar *progr
     Timer t;
 
     t.start();
-    for (Event &event : selectedEvent)
-    {
-        DoRemove(std::move(event), listView->_window->hwnd);
-    }
+    DoRemoveMany(std::move(selectedEvent), listView->_window->hwnd);
     t.end();
 
     message->ReplaceLastMessage(L"Penghapusan selesai dalam " + t.durationStr() + L". Penghapusan mungkin terlihat lama karena proses mendapatkan pilihan dari UI");
@@ -514,6 +610,9 @@ namespace TabOldEvent
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Memproses data");
@@ -538,7 +637,7 @@ namespace TabOldEvent
         }
         timer.end();
 
-        listView.SetRowCount(listSize);
+        listView.ShowItems();
         progress.SetWaiting(false);
         message.ReplaceLastMessage(L"Data ditemukan dalam " + timer.durationStr());
         SetEnable(true);
@@ -548,7 +647,7 @@ namespace TabOldEvent
     {
         MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam param)
@@ -567,7 +666,7 @@ namespace TabOldEvent
         MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -627,7 +726,7 @@ namespace TabFindEventsRange
     UI::Label fromLabel, toLabel;
     UI::TextBox fromTextBox, toTextBox;
     UI::Button btnFind;
-    UI::Button btnAdd, btnDelete, btnCopyId;
+    UI::Button btnAdd, btnDelete, btnDeleteRange, btnCopyId;
     UI::ProgressBar progress;
     UI::LabelWorkMessage label;
     EventListView listView;
@@ -639,29 +738,61 @@ namespace TabFindEventsRange
         btnFind.SetEnable(enable);
         btnAdd.SetEnable(enable);
         btnDelete.SetEnable(enable);
+        btnDeleteRange.SetEnable(enable);
         btnCopyId.SetEnable(enable);
         listView.SetEnable(enable);
     }
 
+    // Rentang yang ditampilkan dan dihapus tab ini, batasnya dicari dalam O(log n)
+    RBTree<Event, EventNameComparer>::Range FindRange(const std::wstring &from, const std::wstring &to)
+    {
+        if (to.empty())
+        {
+            // Batas akhir kosong: semua data dengan nama berawalan batas awal
+            return tree.prefixRange(EventBound(L".", from), [&](const Event &value)
+                                    { return Utils::StartsWith(value.name, from); });
+        }
+
+        return {tree.lowerBound(EventBound(L".", from)), tree.upperBound(EventBound(L":", to))};
+    }
+
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
+    // Batas dan jumlah hasil yang terakhir ditampilkan
+    // "Hapus Semua Hasil" menghapus rentang ini, bukan isi text box saat tombol ditekan
+    struct ShownRange
+    {
+        std::wstring from, to;
+        size_t count;
+        // WorkerThread::WriteVersion saat hasil ditampilkan
+        uint64_t version;
+    };
+    // Ditulis DoRefresh di thread pool baca dan dibaca thread UI
+    WorkerThread::Published<ShownRange> shown;
+
     void DoRefresh()
     {
-        listView.items.clear();
         listView.SetRowCount(0);
 
         label.ReplaceLastMessage(L"Menemukan data");
+        std::wstring from = fromTextBox.getText(), to = toTextBox.getText();
         Timer timer;
 
         progress.SetWaiting(true);
 
         {
+            // Index batas rentang dicari dengan indexOf, baris diambil dari tree saat ditampilkan
             timer.start();
-            tree.findBetween(Event{L".", fromTextBox.getText()}, {L":", toTextBox.getText()}, [&](RBNode<Event> *node)
-                             { listView.items.push_back(&node->value); });
+            auto range = FindRange(from, to);
+            size_t first = tree.indexOf(range.begin());
+            size_t last = tree.indexOf(range.end());
             timer.end();
+            listView.ShowTree(&tree, first, last > first ? last - first : 0);
+            shown.Set({from, to, last > first ? last - first : 0, WorkerThread::WriteVersion()});
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data ditemukan dalam dalam " + timer.durationStr());
         progress.SetWaiting(false);
@@ -673,7 +804,7 @@ namespace TabFindEventsRange
     {
         MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam param)
@@ -692,7 +823,57 @@ namespace TabFindEventsRange
         MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
+        EnqueueRefreshAll(&window);
+        return 0;
+    }
+
+    // Menghapus seluruh hasil pencarian rentang, bukan hanya yang dipilih
+    void DoDeleteRange(const ShownRange &range)
+    {
+        progress.SetWaiting(true);
+        label.ReplaceLastMessage(L"Menghapus rentang");
+
+        // Hanya rentang yang dikonfirmasi yang dihapus, batal jika data berubah setelah hasil ditampilkan
+        auto current = FindRange(range.from, range.to);
+        size_t first = tree.indexOf(current.begin());
+        size_t last = tree.indexOf(current.end());
+        if (range.version != WorkerThread::WriteVersion() || (last > first ? last - first : 0) != range.count)
+        {
+            label.ReplaceLastMessage(L"Data berubah setelah hasil ditampilkan, tidak ada data yang dihapus");
+            MessageSetWait(&label, false);
+            progress.SetWaiting(false);
+            return;
+        }
+
+        ClearAllList();
+
+        Timer timer;
+        timer.start();
+        DoRemoveRange(current, window.hwnd);
+        timer.end();
+
+        label.ReplaceLastMessage(L"Penghapusan rentang selesai dalam " + timer.durationStr());
+        MessageSetWait(&label, false);
+        progress.SetWaiting(false);
+    }
+
+    LRESULT OnDeleteRangeClick(UI::CallbackParam param)
+    {
+        ShownRange range = shown.Get();
+        if (range.count == 0)
+            return 0;
+
+        std::wstring confirm = L"Hapus " + std::to_wstring(range.count) + L" data hasil pencarian? Data dapat dikembalikan dari riwayat penghapusan.";
+        if (MessageBoxW(window.hwnd, confirm.c_str(), L"Hapus Semua Hasil", MB_OKCANCEL | MB_ICONWARNING) != IDOK)
+            return 0;
+
+        // Rentang disalin ke tugas karena refresh berikutnya dapat mengganti rentang yang ditampilkan sebelum tugas berjalan
+        MessageSetWait(&label);
+        SetEnable(false);
+        WorkerThread::EnqueueWork([range]()
+                                  { DoDeleteRange(range); });
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -720,6 +901,9 @@ namespace TabFindEventsRange
         btnDelete.SetText(L"Hapus Event");
         btnDelete.commandListener = OnDeleteClick;
 
+        btnDeleteRange.SetText(L"Hapus Semua Hasil");
+        btnDeleteRange.commandListener = OnDeleteRangeClick;
+
         window.controlsLayout = {
             {UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &fromLabel),
              UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &fromTextBox),
@@ -732,7 +916,8 @@ namespace TabFindEventsRange
             {UI::EmptyCell(UI::SIZE_FILL, UI::SIZE_DEFAULT),
              UI::ControlCell(100, UI::SIZE_DEFAULT, &btnCopyId),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnAdd),
-             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete)}};
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete),
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDeleteRange)}};
 
         UI::LayoutControls(&window, true);
 
@@ -768,11 +953,13 @@ namespace TabAllEvents
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         std::wstring type = combobox.GetSelectedText();
 
-        listView.items.resize(tree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -782,23 +969,30 @@ namespace TabAllEvents
 
         {
             timer.start();
-            size_t current = 0;
-            std::function<void(RBNode<Event> *)> visitor = [&](RBNode<Event> *node)
-            {
-                listView.items[current] = &node->value;
-                current++;
-            };
             if (type == L"In-order")
-                tree.inorder(tree.root, visitor);
-            else if (type == L"Pre-order")
-                tree.preorder(tree.root, visitor);
-            else if (type == L"Post-order")
-                tree.postorder(tree.root, visitor);
+            {
+                listView.ShowTree(&tree, 0, tree.count);
+            }
+            else
+            {
+                listView.items.resize(tree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Event> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+
+                if (type == L"Pre-order")
+                    tree.preorder(tree.root, visitor);
+                else if (type == L"Post-order")
+                    tree.postorder(tree.root, visitor);
+                listView.ShowItems();
+            }
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
 
@@ -809,7 +1003,7 @@ namespace TabAllEvents
     {
         MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -828,7 +1022,7 @@ namespace TabAllEvents
         MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -901,6 +1095,9 @@ namespace TabDetailsEvents
         btnDelete.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         label.ReplaceLastMessage(L"Mencari Event sesuai dengan ID Event");
@@ -924,9 +1121,9 @@ namespace TabDetailsEvents
 
             listView.SetText(0, 1, currentEvent.id);
             listView.SetText(1, 1, currentEvent.name);
-            listView.SetText(2, 1, currentEvent.location);
-            listView.SetText(3, 1, currentEvent.country);
-            listView.SetText(4, 1, currentEvent.genre);
+            listView.SetText(2, 1, Dictionary::get(currentEvent.location));
+            listView.SetText(3, 1, Dictionary::get(currentEvent.country));
+            listView.SetText(4, 1, Dictionary::get(currentEvent.genre));
             listView.SetText(5, 1, std::to_wstring(currentEvent.visitor));
             listView.SetText(6, 1, Utils::SystemTimeToDateStr(currentEvent.date));
             listView.SetText(7, 1, currentEvent.description);
@@ -938,7 +1135,7 @@ namespace TabDetailsEvents
     {
         MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam)
@@ -969,7 +1166,7 @@ namespace TabDetailsEvents
         MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
 
         return 0;
@@ -1029,18 +1226,90 @@ namespace MainWindow
     UI::StatusBar statusBar;
     UI::ProgressBar progressBar;
 
+    const std::string csvPath = "data/FestDataFiksBgt.csv";
+    const std::string snapshotPath = "data/FestDataFiksBgt.snapshot";
+    // Naikkan jika isi Event atau EventNameComparer berubah
+    const uint32_t snapshotRecordVersion = 1;
+
+    void WriteEvent(SnapshotWriter &writer, const Event &event)
+    {
+        writer.writeWString(event.id);
+        writer.writeWString(event.name);
+        writer.writeWString(Dictionary::get(event.location));
+        writer.writeWString(Dictionary::get(event.country));
+        writer.writeWString(Dictionary::get(event.genre));
+        writer.writePod(event.visitor);
+        writer.writePod(event.date);
+        writer.writeWString(event.description);
+    }
+
+    Event ReadEvent(SnapshotReader &reader)
+    {
+        Event event;
+        event.id = reader.readWString();
+        event.name = reader.readWString();
+        event.location = locations.intern(reader.readWString());
+        event.country = countries.intern(reader.readWString());
+        event.genre = genres.intern(reader.readWString());
+        event.visitor = reader.readPod<int>();
+        event.date = reader.readPod<SYSTEMTIME>();
+        event.description = reader.readWString();
+        UpdateSortKey(event);
+        return event;
+    }
+
+    // Baris CSV yang formatnya salah pada pemuatan terakhir, dilewati tanpa membatalkan pemuatan
+    std::vector<CSVQuarantinedRow> quarantine;
+
+    // Keterangan baris yang dilewati untuk status bar, kosong jika tidak ada
+    std::wstring QuarantineStr()
+    {
+        if (quarantine.empty())
+            return L"";
+
+        return L", " + std::to_wstring(quarantine.size()) + L" baris dilewati (baris " +
+               std::to_wstring(quarantine.front().line) + L": " +
+               std::wstring(quarantine.front().message.begin(), quarantine.front().message.end()) + L")";
+    }
+
+    bool LoadSnapshot(const SnapshotSource &source)
+    {
+        if (!LoadTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, ReadEvent))
+            return false;
+
+        hashTable.reserve(tree.count);
+        tree.inorder(tree.root, [&](RBNode<Event> *node)
+                     { hashTable.put(node->value.id, node->value); });
+        return true;
+    }
+
     void DoLoad()
     {
 
         progressBar.SetWaiting(true);
 
         Timer timer;
+        SnapshotSource source;
+        bool hasSource = source.read(csvPath);
+
+        statusBar.SetText(1, L"Memuat data dari snapshot");
+        timer.start();
+        if (hasSource && LoadSnapshot(source))
+        {
+            timer.end();
+            progressBar.SetWaiting(false);
+            statusBar.SetText(1, L"Data dimuat dari snapshot dalam " + timer.durationStr());
+            return;
+        }
+
         statusBar.SetText(1, L"Memuat data dari CSV");
 
         {
             timer.start();
-            CSVReader<CSVReaderIOBuffSync> reader("data/FestDataFiksBgt.csv", ';');
+            CSVReader<CSVReaderIOMapped> reader(csvPath, ';');
             reader.startRead();
+            reader.projection = true;
+            reader.lenient = true;
 
             int idIndex = reader.findHeaderIndex("Festival_ID");
             int nameIndex = reader.findHeaderIndex("Festival_Name");
@@ -1051,25 +1320,56 @@ namespace MainWindow
             int dateIndex = reader.findHeaderIndex("Date");
             int descriptionIndex = reader.findHeaderIndex("Description");
 
-            while (reader.readData())
+            // Lokasi, negara, dan genre disimpan sebagai byte UTF-8 dan dimasukkan ke kamus di thread pemanggil
+            struct EventRow
             {
-                Event event{
-                    Utils::stringviewToWstring(reader.data[idIndex]),
-                    Utils::stringviewToWstring(reader.data[nameIndex]),
-                    Utils::stringviewToWstring(reader.data[locationIndex]),
-                    Utils::stringviewToWstring(reader.data[countryIndex]),
-                    Utils::stringviewToWstring(reader.data[genreIndex]),
-                    std::stoi(Utils::stringviewToWstring(reader.data[visitorIndex])),
-                    Utils::DateStrToSystemTime(Utils::stringviewToWstring(reader.data[dateIndex])),
-                    Utils::stringviewToWstring(reader.data[descriptionIndex])};
-                hashTable.put(event.id, event);
-                tree.insert(std::move(event));
-            }
+                Event event;
+                std::string location, country, genre;
+            };
+
+            // Tree dibangun sekaligus setelah seluruh baris dibaca
+            std::vector<Event> events;
+            reader.readParallel<EventRow>(
+                std::thread::hardware_concurrency(),
+                [&](const std::vector<Utils::StringView> &data)
+                {
+                    EventRow row;
+                    Utils::stringviewsToWstrings(data, {{idIndex, &row.event.id},
+                                                        {nameIndex, &row.event.name},
+                                                        {descriptionIndex, &row.event.description}});
+                    row.location.assign(data[locationIndex].begin, data[locationIndex].size);
+                    row.country.assign(data[countryIndex].begin, data[countryIndex].size);
+                    row.genre.assign(data[genreIndex].begin, data[genreIndex].size);
+                    row.event.visitor = CSVField::toInt(data, visitorIndex);
+                    row.event.date = CSVField::toDate(data, dateIndex);
+                    UpdateSortKey(row.event);
+                    return row;
+                },
+                [&](EventRow &&row)
+                {
+                    row.event.location = locations.internUtf8(row.location);
+                    row.event.country = countries.internUtf8(row.country);
+                    row.event.genre = genres.internUtf8(row.genre);
+                    hashTable.put(row.event.id, row.event);
+                    events.push_back(std::move(row.event));
+                });
+            tree.insertBulk(std::move(events));
+            quarantine = std::move(reader.quarantine);
             timer.end();
         }
+
+        // Snapshot hanya untuk mempercepat pemuatan berikutnya, kegagalan menulis tidak mengganggu aplikasi
+        try
+        {
+            if (hasSource)
+                SaveTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, WriteEvent);
+        }
+        catch (const std::domain_error &)
+        {
+        }
         progressBar.SetWaiting(false);
 
-        statusBar.SetText(1, L"Data dimuat dari CSV dalam " + timer.durationStr());
+        statusBar.SetText(1, L"Data dimuat dari CSV dalam " + timer.durationStr() + QuarantineStr());
     }
 
     LRESULT OnClose(UI::CallbackParam param) {
@@ -1142,6 +1442,7 @@ void ClearAllList()
     TabAllEvents::listView.SetRowCount(0);
     TabFindEventsRange::listView.SetRowCount(0);
     TabOldEvent::listView.SetRowCount(0);
+    TabHistoryDelete::listView.SetRowCount(0);
 }
 
 void EnqueueRefreshAll(UI::Window *callerWindow)
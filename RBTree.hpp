@@ -4,17 +4,122 @@
 #include <stdexcept>
 #include <iostream>
 #include <algorithm>
-#include <functional>
+#include <iterator>
 #include <stack>
+#include <vector>
+#include <memory>
+#include <type_traits>
 
 template <typename T>
 struct RBNode
 {
     RBNode<T> *left = nullptr, *right = nullptr, *parent = nullptr;
     bool isRed = true;
+    // Jumlah node di subtree ini termasuk node ini sendiri, 0 untuk nil
+    size_t size = 1;
     T value;
 };
 
+/**
+ * Allocator node dengan new dan delete untuk setiap node
+ */
+template <typename T>
+struct RBNodeAllocatorHeap
+{
+    using NodeType = RBNode<T>;
+
+    // Node harus dihapus satu per satu saat tree dikosongkan
+    static constexpr bool canReleaseAll = false;
+
+    NodeType *allocate()
+    {
+        return new NodeType();
+    }
+
+    void deallocate(NodeType *node)
+    {
+        delete node;
+    }
+
+    void releaseAll()
+    {
+    }
+};
+
+/**
+ * Allocator node dari pool
+ * Node dialokasikan per chunk (array node), ukuran chunk berlipat dua sampai maxChunkSize
+ * sehingga node yang dimasukkan berurutan letaknya berdekatan di memori
+ * Node yang dihapus masuk ke free list dan dipakai ulang oleh allocate berikutnya
+ *
+ * Alamat node tidak pernah berubah sampai releaseAll, sehingga pointer ke nilai di node tetap berlaku
+ * releaseAll membebaskan seluruh chunk sekaligus tanpa menelusuri tree
+ */
+template <typename T>
+struct RBNodeAllocatorPool
+{
+    using NodeType = RBNode<T>;
+
+    static constexpr bool canReleaseAll = true;
+    static constexpr size_t minChunkSize = 64;
+    static constexpr size_t maxChunkSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<NodeType[]>> chunks;
+    size_t chunkSize = 0;
+    // Jumlah node yang sudah dipakai di chunk terakhir
+    size_t chunkUsed = 0;
+    // Node yang sudah dihapus, dihubungkan dengan pointer left
+    NodeType *freeList = nullptr;
+
+    NodeType *allocate()
+    {
+        NodeType *node;
+
+        if (freeList != nullptr)
+        {
+            node = freeList;
+            freeList = node->left;
+            node->left = nullptr;
+        }
+        else
+        {
+            if (chunkUsed == chunkSize)
+            {
+                if (chunks.empty())
+                    chunkSize = minChunkSize;
+                else if (chunkSize * 2 <= maxChunkSize)
+                    chunkSize *= 2;
+                chunks.push_back(std::unique_ptr<NodeType[]>(new NodeType[chunkSize]));
+                chunkUsed = 0;
+            }
+
+            node = &chunks.back()[chunkUsed++];
+        }
+
+        return node;
+    }
+
+    void deallocate(NodeType *node)
+    {
+        // Isi nilai dibebaskan sekarang, bukan saat node dipakai ulang
+        node->value = T();
+        node->right = nullptr;
+        node->parent = nullptr;
+        node->isRed = true;
+
+        node->left = freeList;
+        freeList = node;
+    }
+
+    void releaseAll()
+    {
+        chunks.clear();
+        chunkSize = 0;
+        chunkUsed = 0;
+        freeList = nullptr;
+    }
+};
+
 /**
  * Red Black Tree
  * BST dengan kemampuan auto balance
@@ -22,16 +127,18 @@ struct RBNode
  * T = Tipe Data Nilai
  * K = Pembangind
  * K harus class yang mempunyai fungsi compare dengan signature int compare(const &T a, const &T b)
+ * A = Allocator node, RBNodeAllocatorPool (default) atau RBNodeAllocatorHeap
  *
  * Malas menamai beberapa variabel
  */
-template <typename T, typename K>
+template <typename T, typename K, typename A = RBNodeAllocatorPool<T>>
 struct RBTree
 {
     using NodeType = RBNode<T>;
     NodeType *root = nullptr;
     size_t count = 0;
     K comparer;
+    A allocator;
     NodeType *nil;
 
     RBTree()
@@ -41,10 +148,29 @@ struct RBTree
         nil->right = nullptr;
         nil->parent = nullptr;
         nil->isRed = false;
+        nil->size = 0;
         root = nil;
     }
 
     ~RBTree()
+    {
+        clear();
+        delete nil;
+    }
+
+    void clear()
+    {
+        clearNodes(std::integral_constant<bool, A::canReleaseAll>());
+        root = nil;
+        count = 0;
+    }
+
+    void clearNodes(std::true_type)
+    {
+        allocator.releaseAll();
+    }
+
+    void clearNodes(std::false_type)
     {
         std::stack<NodeType *> st;
         if (root != nil)
@@ -59,17 +185,209 @@ struct RBTree
                 st.push(top->left);
             if (top->right != nil)
                 st.push(top->right);
-            delete top;
+            allocator.deallocate(top);
         }
+    }
 
-        delete nil;
+    /**
+     * Membangun ulang tree dari values yang sudah terurut sesuai comparer tanpa duplikat dalam O(n)
+     * Isi tree sebelumnya dihapus
+     */
+    void buildFromSorted(std::vector<T> &&values)
+    {
+        for (size_t i = 1; i < values.size(); i++)
+        {
+            if (comparer.compare(values[i - 1], values[i]) >= 0)
+                throw std::domain_error("Values are not sorted");
+        }
+
+        clear();
+
+        // Node dialokasikan sesuai urutan sehingga traversal inorder membaca memori secara berurutan
+        std::vector<NodeType *> nodes;
+        nodes.reserve(values.size());
+        for (T &value : values)
+        {
+            NodeType *node = allocator.allocate();
+            node->value = std::move(value);
+            nodes.push_back(node);
+        }
+
+        linkSorted(nodes);
+    }
+
+    /**
+     * Memasukkan banyak nilai sekaligus, values tidak harus terurut
+     * Jika ada nilai yang sama di values atau nilai yang sudah ada di tree,
+     * melempar std::domain_error("Value has been added") dan tree tidak diubah
+     *
+     * - Tree kosong dibangun dengan buildFromSorted dalam O(m log m) untuk pengurutan ditambah O(m)
+     * - Jika values sedikit dibanding isi tree, setiap nilai dimasukkan dengan insert
+     * - Selain itu values digabung (merge) dengan isi tree lalu tree disusun ulang dalam O(n + m)
+     * Node yang sudah ada tidak dipindahkan sehingga pointer ke nilainya tetap berlaku
+     */
+    void insertBulk(std::vector<T> &&values)
+    {
+        sortValues(values);
+
+        if (count == 0)
+        {
+            buildFromSorted(std::move(values));
+            return;
+        }
+
+        int treeHeight = 1;
+        for (size_t n = count; n > 1; n >>= 1)
+            treeHeight++;
+
+        if (values.size() * treeHeight < count)
+        {
+            for (const T &value : values)
+            {
+                if (findNode(value) != nil)
+                    throw std::domain_error("Value has been added");
+            }
+
+            for (T &value : values)
+                insert(std::move(value));
+            return;
+        }
+
+        mergeSorted(values);
+    }
+
+    // Mengurutkan values sesuai comparer, melempar std::domain_error jika ada nilai yang sama
+    void sortValues(std::vector<T> &values)
+    {
+        bool sorted = true;
+        for (size_t i = 1; i < values.size() && sorted; i++)
+            sorted = comparer.compare(values[i - 1], values[i]) < 0;
+
+        if (sorted)
+            return;
+
+        std::sort(values.begin(), values.end(), [this](const T &a, const T &b)
+                  { return comparer.compare(a, b) < 0; });
+
+        for (size_t i = 1; i < values.size(); i++)
+        {
+            if (comparer.compare(values[i - 1], values[i]) == 0)
+                throw std::domain_error("Value has been added");
+        }
+    }
+
+    /**
+     * Menggabungkan values yang sudah terurut dengan isi tree dalam O(n + m)
+     * Urutan gabungan ditentukan terlebih dahulu sehingga tree tidak diubah jika ada nilai yang sama
+     */
+    void mergeSorted(std::vector<T> &values)
+    {
+        std::vector<NodeType *> existing;
+        existing.reserve(count);
+        inorder(root, [&](NodeType *node)
+                { existing.push_back(node); });
+
+        // true jika elemen berikutnya diambil dari tree, false jika dari values
+        std::vector<bool> takeExisting;
+        takeExisting.reserve(existing.size() + values.size());
+
+        size_t i = 0, j = 0;
+        while (i < existing.size() || j < values.size())
+        {
+            if (j == values.size())
+            {
+                takeExisting.push_back(true);
+                i++;
+                continue;
+            }
+            if (i == existing.size())
+            {
+                takeExisting.push_back(false);
+                j++;
+                continue;
+            }
+
+            int cmp = comparer.compare(existing[i]->value, values[j]);
+            if (cmp == 0)
+                throw std::domain_error("Value has been added");
+
+            takeExisting.push_back(cmp < 0);
+            if (cmp < 0)
+                i++;
+            else
+                j++;
+        }
+
+        std::vector<NodeType *> nodes;
+        nodes.reserve(takeExisting.size());
+        i = j = 0;
+        for (bool fromTree : takeExisting)
+        {
+            if (fromTree)
+            {
+                nodes.push_back(existing[i++]);
+                continue;
+            }
+
+            NodeType *node = allocator.allocate();
+            node->value = std::move(values[j++]);
+            nodes.push_back(node);
+        }
+
+        linkSorted(nodes);
+    }
+
+    /**
+     * Menyusun nodes yang sudah terurut menjadi tree tanpa rotasi dan tanpa membandingkan nilai
+     * Elemen tengah menjadi root dan kedua sisi disusun secara rekursif,
+     * sehingga semua level terisi penuh kecuali level terdalam
+     * Node pada level terdalam diwarnai merah dan sisanya hitam agar jumlah node hitam di setiap jalur sama
+     */
+    void linkSorted(std::vector<NodeType *> &nodes)
+    {
+        count = nodes.size();
+        if (nodes.empty())
+        {
+            root = nil;
+            return;
+        }
+
+        int redLevel = 0;
+        for (size_t n = nodes.size(); n > 1; n >>= 1)
+            redLevel++;
+
+        root = linkSubtree(nodes, 0, nodes.size(), 0, redLevel);
+        root->parent = nullptr;
+        root->isRed = false;
+    }
+
+    NodeType *linkSubtree(std::vector<NodeType *> &nodes, size_t from, size_t to, int level, int redLevel)
+    {
+        if (from == to)
+            return nil;
+
+        size_t mid = from + (to - from) / 2;
+        NodeType *node = nodes[mid];
+        node->isRed = level == redLevel;
+
+        node->left = linkSubtree(nodes, from, mid, level + 1, redLevel);
+        node->right = linkSubtree(nodes, mid + 1, to, level + 1, redLevel);
+
+        if (node->left != nil)
+            node->left->parent = node;
+        if (node->right != nil)
+            node->right->parent = node;
+        node->size = node->left->size + node->right->size + 1;
+
+        return node;
     }
 
     void insert(T &&value)
     {
-        NodeType *z = new NodeType();
+        NodeType *z = allocator.allocate();
         z->left = nil;
         z->right = nil;
+        z->size = 1;
         z->value = std::move(value);
 
         if (root == nil)
@@ -97,6 +415,7 @@ struct RBTree
                 }
                 else
                 {
+                    allocator.deallocate(z);
                     throw std::domain_error("Value has been added");
                 }
             }
@@ -110,6 +429,8 @@ struct RBTree
             {
                 y->right = z;
             }
+            for (NodeType *p = y; p != nullptr; p = p->parent)
+                p->size++;
             insertFixUp(z);
         }
         count++;
@@ -152,13 +473,26 @@ struct RBTree
         v->parent = u->parent;
     }
 
+    // Mengembalikan nil jika subtree x kosong
     NodeType *minimum(NodeType *x)
     {
+        if (x == nil)
+            return nil;
         while (x->left != nil)
             x = x->left;
         return x;
     }
 
+    // Mengembalikan nil jika subtree x kosong
+    NodeType *maximum(NodeType *x)
+    {
+        if (x == nil)
+            return nil;
+        while (x->right != nil)
+            x = x->right;
+        return x;
+    }
+
     bool remove(const T &value)
     {
         NodeType *node = findNode(value);
@@ -172,11 +506,65 @@ struct RBTree
         return true;
     }
 
+    /**
+     * Menghapus banyak nilai sekaligus, values diurutkan sesuai comparer
+     * Nilai yang tidak ada di tree dilewati, mengembalikan jumlah nilai yang dihapus
+     *
+     * - Jika values sedikit dibanding isi tree, setiap nilai dihapus dengan remove
+     * - Selain itu isi tree dan values ditelusuri bersamaan sekali, node yang dihapus dilepas,
+     *   lalu node yang tersisa disusun ulang dengan linkSorted dalam O(n + m) tanpa rotasi
+     * Node yang tersisa tidak dipindahkan sehingga pointer ke nilainya tetap berlaku
+     */
+    size_t removeMany(std::vector<T> &values)
+    {
+        size_t before = count;
+        std::sort(values.begin(), values.end(), [this](const T &a, const T &b)
+                  { return comparer.compare(a, b) < 0; });
+
+        int treeHeight = 1;
+        for (size_t n = count; n > 1; n >>= 1)
+            treeHeight++;
+
+        if (values.size() * treeHeight < count)
+        {
+            for (const T &value : values)
+                remove(value);
+            return before - count;
+        }
+
+        std::vector<NodeType *> kept;
+        kept.reserve(count);
+        std::vector<NodeType *> removed;
+        size_t j = 0;
+        inorder(root, [&](NodeType *node)
+                {
+                    while (j < values.size() && comparer.compare(values[j], node->value) < 0)
+                        j++;
+
+                    if (j < values.size() && comparer.compare(values[j], node->value) == 0)
+                        removed.push_back(node);
+                    else
+                        kept.push_back(node);
+                });
+
+        // Node dilepas setelah penelusuran karena inorder berpindah melalui pointer parent
+        for (NodeType *node : removed)
+            allocator.deallocate(node);
+
+        linkSorted(kept);
+        return before - count;
+    }
+
     void removeNode(NodeType *z)
     {
         NodeType *y = z;
         bool yOrigRed = y->isRed;
 
+        // Node yang benar-benar dilepas dari posisinya adalah z, atau minimum subtree kanan jika z mempunyai dua anak
+        NodeType *removed = z->left == nil || z->right == nil ? z : minimum(z->right);
+        for (NodeType *p = removed->parent; p != nullptr; p = p->parent)
+            p->size--;
+
         NodeType *x = nullptr;
         if (z->left == nil)
         {
@@ -207,9 +595,10 @@ struct RBTree
             y->left = z->left;
             y->left->parent = y;
             y->isRed = z->isRed;
+            y->size = z->size;
         }
 
-        delete z;
+        allocator.deallocate(z);
         if (!yOrigRed)
             removeFixUp(x);
 
@@ -292,77 +681,624 @@ struct RBTree
         x->isRed = false;
     }
 
-    void internalFindBetween(
-        NodeType *node,
-        const T &from,
-        const T &to,
-        const std::function<void(NodeType *)> &visitor)
+    // Node terkecil sesudah node (inorder), nil jika node adalah node terbesar
+    NodeType *successor(NodeType *node)
     {
-        if (node == nullptr)
+        if (node->right != nil)
+            return minimum(node->right);
+
+        NodeType *parent = node->parent;
+        while (parent != nullptr && node == parent->right)
         {
-            return;
+            node = parent;
+            parent = parent->parent;
         }
+        return parent == nullptr ? nil : parent;
+    }
 
-        int cmpFrom = comparer.compare(node->value, from);
-        int cmpTo = comparer.compare(node->value, to);
-        if (cmpFrom >= 0 && cmpTo <= 0)
+    // Node terbesar sebelum node (inorder), nil jika node adalah node terkecil
+    NodeType *predecessor(NodeType *node)
+    {
+        if (node->left != nil)
+            return maximum(node->left);
+
+        NodeType *parent = node->parent;
+        while (parent != nullptr && node == parent->left)
         {
-            internalFindBetween(node->left, from, to, visitor);
-            visitor(node);
-            internalFindBetween(node->right, from, to, visitor);
+            node = parent;
+            parent = parent->parent;
         }
-        // cmpFrom < 0 && cmpTo <= 0
-        else if (cmpFrom < 0)
+        return parent == nullptr ? nil : parent;
+    }
+
+    /**
+     * Iterator inorder (terurut) dua arah untuk range-for dan algoritma standar
+     * Berpindah node melalui pointer parent, tanpa rekursi dan tanpa alokasi
+     * end() menunjuk ke nil, --end() adalah node terbesar
+     * Iterator tidak berlaku lagi jika node yang ditunjuk dihapus, insert dan remove node lain tidak memengaruhi
+     */
+    struct Iterator
+    {
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
+
+        RBTree *tree;
+        NodeType *node;
+
+        T &operator*() const
         {
-            internalFindBetween(node->right, from, to, visitor);
+            return node->value;
         }
-        // cmpFrom >= 0 && cmpTo > 0
-        else
+
+        T *operator->() const
+        {
+            return &node->value;
+        }
+
+        Iterator &operator++()
+        {
+            node = tree->successor(node);
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator old = *this;
+            node = tree->successor(node);
+            return old;
+        }
+
+        Iterator &operator--()
+        {
+            node = node == tree->nil ? tree->maximum(tree->root) : tree->predecessor(node);
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator old = *this;
+            --*this;
+            return old;
+        }
+
+        bool operator==(const Iterator &other) const
+        {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iterator &other) const
+        {
+            return node != other.node;
+        }
+    };
+
+    Iterator begin()
+    {
+        return Iterator{this, minimum(root)};
+    }
+
+    Iterator end()
+    {
+        return Iterator{this, nil};
+    }
+
+    // Iterator ke nilai pertama yang tidak lebih kecil dari value
+    Iterator lowerBound(const T &value)
+    {
+        NodeType *current = root;
+        NodeType *result = nil;
+
+        while (current != nil)
+        {
+            if (comparer.compare(current->value, value) >= 0)
+            {
+                result = current;
+                current = current->left;
+            }
+            else
+            {
+                current = current->right;
+            }
+        }
+
+        return Iterator{this, result};
+    }
+
+    // Iterator ke nilai pertama yang lebih besar dari value
+    Iterator upperBound(const T &value)
+    {
+        NodeType *current = root;
+        NodeType *result = nil;
+
+        while (current != nil)
         {
-            internalFindBetween(node->left, from, to, visitor);
+            if (comparer.compare(current->value, value) > 0)
+            {
+                result = current;
+                current = current->left;
+            }
+            else
+            {
+                current = current->right;
+            }
         }
+
+        return Iterator{this, result};
     }
 
-    void findBetween(
-        const T &from,
-        const T &to,
-        const std::function<void(NodeType *)> &visitor)
+    /**
+     * Rentang iterator [first, last) yang dapat dipakai dengan range-for
+     */
+    struct Range
+    {
+        Iterator first, last;
+
+        Iterator begin() const
+        {
+            return first;
+        }
+
+        Iterator end() const
+        {
+            return last;
+        }
+
+        bool empty() const
+        {
+            return first == last;
+        }
+    };
+
+    /**
+     * Rentang nilai yang berawalan sama (prefix), batasnya dicari dalam O(log n)
+     * from adalah nilai terkecil yang mungkin berawalan prefix, misalnya nilai dengan kunci sama dengan prefix
+     * inPrefix dengan signature bool inPrefix(const T &value) mengembalikan true jika value berawalan prefix
+     *
+     * Semua nilai yang berawalan prefix harus berurutan mulai dari lowerBound(from),
+     * berlaku untuk urutan leksikografis seperti Utils::CompareWStringHalfInsensitive dengan Utils::StartsWith
+     * Hanya node yang cocok yang dikunjungi saat rentang ditelusuri,
+     * penelusuran dapat dihentikan kapan saja, misalnya setelah N hasil pertama
+     */
+    template <typename Match>
+    Range prefixRange(const T &from, Match inPrefix)
     {
-        internalFindBetween(root, from, to, visitor);
+        // Node pertama yang tidak lebih kecil dari from dan tidak berawalan prefix
+        NodeType *current = root;
+        NodeType *last = nil;
+
+        while (current != nil)
+        {
+            if (comparer.compare(current->value, from) < 0 || inPrefix(current->value))
+            {
+                current = current->right;
+            }
+            else
+            {
+                last = current;
+                current = current->left;
+            }
+        }
+
+        return Range{lowerBound(from), Iterator{this, last}};
     }
 
-    void inorder(NodeType *node, const std::function<void(NodeType *)> &visit)
+    // Index inorder dari iterator dalam O(log n) melalui ukuran subtree, count untuk end()
+    size_t indexOf(const Iterator &it)
     {
+        NodeType *node = it.node;
         if (node == nil)
+            return count;
+
+        size_t index = node->left->size;
+        for (; node->parent != nullptr; node = node->parent)
         {
-            return;
+            if (node == node->parent->right)
+                index += node->parent->left->size + 1;
+        }
+        return index;
+    }
+
+    /**
+     * Node ke-index (dimulai dari 0) secara inorder dalam O(log n), nil jika index >= count
+     * Menggunakan ukuran subtree di setiap node (order statistic tree)
+     */
+    NodeType *select(size_t index)
+    {
+        NodeType *current = root;
+
+        while (current != nil)
+        {
+            size_t leftSize = current->left->size;
+            if (index < leftSize)
+            {
+                current = current->left;
+            }
+            else if (index == leftSize)
+            {
+                return current;
+            }
+            else
+            {
+                index -= leftSize + 1;
+                current = current->right;
+            }
+        }
+
+        return nil;
+    }
+
+    // Jumlah nilai yang lebih kecil dari value, yaitu index dari lowerBound(value)
+    size_t rank(const T &value)
+    {
+        NodeType *current = root;
+        size_t result = 0;
+
+        while (current != nil)
+        {
+            if (comparer.compare(current->value, value) < 0)
+            {
+                result += current->left->size + 1;
+                current = current->right;
+            }
+            else
+            {
+                current = current->left;
+            }
+        }
+
+        return result;
+    }
+
+    // Jumlah nilai yang tidak lebih besar dari value, yaitu index dari upperBound(value)
+    size_t upperRank(const T &value)
+    {
+        NodeType *current = root;
+        size_t result = 0;
+
+        while (current != nil)
+        {
+            if (comparer.compare(current->value, value) <= 0)
+            {
+                result += current->left->size + 1;
+                current = current->right;
+            }
+            else
+            {
+                current = current->left;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Melepas seluruh nilai dalam rentang iterator [first, last) dari tree sekaligus
+     * Nilai dikembalikan terurut, misalnya untuk dimasukkan ke tree lain dengan insertBulk
+     * Jika last sebelum first, rentang dianggap kosong
+     *
+     * Tree dipisah (split) pada first dan last lalu bagian kiri dan kanan disambung (join) kembali,
+     * sehingga struktur tree berubah dalam O(log n) tanpa menghapus node satu per satu
+     * Node dalam rentang hanya dilepas ke allocator dalam O(k), tanpa rotasi
+     */
+    std::vector<T> extractRange(Iterator first, Iterator last)
+    {
+        std::vector<T> values;
+        if (first == last || indexOf(last) <= indexOf(first))
+            return values;
+
+        NodeType *firstNode = first.node, *lastNode = last.node;
+        SplitResult head = split(root, blackHeight(root), firstNode->value);
+
+        // Node dalam rentang: firstNode dan subtree middle
+        NodeType *middle = head.greater;
+        if (lastNode == nil)
+        {
+            root = head.less;
+        }
+        else
+        {
+            SplitResult tail = split(head.greater, head.greaterHeight, lastNode->value);
+            middle = tail.less;
+            int height;
+            root = join(head.less, head.lessHeight, tail.match, tail.greater, tail.greaterHeight, height);
+        }
+
+        if (root != nil)
+        {
+            root->parent = nullptr;
+            root->isRed = false;
         }
-        inorder(node->left, visit);
-        visit(node);
-        inorder(node->right, visit);
+        count = root->size;
+
+        std::vector<NodeType *> removed;
+        removed.reserve(middle->size + 1);
+        removed.push_back(firstNode);
+        inorder(middle, [&](NodeType *node)
+                { removed.push_back(node); });
+
+        values.reserve(removed.size());
+        for (NodeType *node : removed)
+        {
+            values.push_back(std::move(node->value));
+            allocator.deallocate(node);
+        }
+        return values;
+    }
+
+    // Melepas seluruh nilai dengan from <= nilai <= to, lihat extractRange(Iterator, Iterator)
+    std::vector<T> extractRange(const T &from, const T &to)
+    {
+        return extractRange(lowerBound(from), upperBound(to));
     }
 
-    void preorder(NodeType *node, const std::function<void(NodeType *)> &visit)
+    /**
+     * Jumlah node hitam di jalur dari node ke leaf, termasuk node jika hitam dan tanpa nil
+     * Sama untuk setiap jalur, sehingga cukup menelusuri anak kiri
+     */
+    int blackHeight(NodeType *node)
+    {
+        int height = 0;
+        for (; node != nil; node = node->left)
+        {
+            if (!node->isRed)
+                height++;
+        }
+        return height;
+    }
+
+    /**
+     * Hasil split: less berisi nilai < key, greater berisi nilai > key,
+     * match adalah node dengan nilai sama dengan key (nil jika tidak ada)
+     * less dan greater adalah subtree terpisah (parent root nullptr) beserta black height masing-masing
+     */
+    struct SplitResult
+    {
+        NodeType *less, *match, *greater;
+        int lessHeight, greaterHeight;
+    };
+
+    /**
+     * Memisah subtree node (parent node harus sudah dilepas atau node adalah root) pada key dalam O(log n)
+     * height adalah blackHeight(node). Node di sepanjang jalur pencarian dipakai sebagai pivot join
+     * untuk menyusun kembali kedua bagian, node lain tidak disentuh
+     * Member root tidak diubah, pemanggil menetapkan root dari hasil split dan join
+     */
+    SplitResult split(NodeType *node, int height, const T &key)
     {
         if (node == nil)
+            return SplitResult{nil, nil, nil, 0, 0};
+
+        NodeType *left = node->left, *right = node->right;
+        int childHeight = height - (node->isRed ? 0 : 1);
+        left->parent = nullptr;
+        right->parent = nullptr;
+
+        int cmp = comparer.compare(key, node->value);
+        if (cmp == 0)
+            return SplitResult{left, node, right, childHeight, childHeight};
+
+        SplitResult result;
+        if (cmp < 0)
+        {
+            result = split(left, childHeight, key);
+            result.greater = join(result.greater, result.greaterHeight, node, right, childHeight, result.greaterHeight);
+        }
+        else
+        {
+            result = split(right, childHeight, key);
+            result.less = join(left, childHeight, node, result.less, result.lessHeight, result.lessHeight);
+        }
+        return result;
+    }
+
+    /**
+     * Menyambung subtree left, node pivot, dan subtree right menjadi satu subtree dalam O(|leftHeight - rightHeight| + 1)
+     * Semua nilai di left < pivot < semua nilai di right, leftHeight dan rightHeight adalah black height masing-masing
+     * Pivot ditempelkan di sisi subtree yang lebih tinggi pada node hitam dengan black height sama dengan subtree lain,
+     * lalu diperbaiki seperti insert. Mengembalikan root hasil (parent nullptr), black height hasil di height
+     */
+    NodeType *join(NodeType *left, int leftHeight, NodeType *pivot, NodeType *right, int rightHeight, int &height)
+    {
+        // Root subtree selalu boleh diwarnai hitam, black height bertambah satu
+        if (left->isRed)
         {
+            left->isRed = false;
+            leftHeight++;
+        }
+        if (right->isRed)
+        {
+            right->isRed = false;
+            rightHeight++;
+        }
+
+        pivot->parent = nullptr;
+        if (leftHeight == rightHeight)
+        {
+            pivot->isRed = false;
+            linkPivot(pivot, left, right);
+            height = leftHeight + 1;
+            return pivot;
+        }
+
+        // insertFixUp dan rotasi bekerja pada member root, sehingga root diganti sementara dengan root subtree
+        NodeType *savedRoot = root;
+        if (leftHeight > rightHeight)
+        {
+            // Turun di sisi kanan left sampai node hitam dengan black height rightHeight, bisa nil
+            // Parent dicatat saat turun karena parent nil tidak dapat dipakai
+            NodeType *current = left, *parent = nullptr;
+            int currentHeight = leftHeight;
+            while (current->isRed || currentHeight > rightHeight)
+            {
+                if (!current->isRed)
+                    currentHeight--;
+                parent = current;
+                current = current->right;
+            }
+
+            linkPivot(pivot, current, right);
+            pivot->parent = parent;
+            parent->right = pivot;
+            root = left;
+            height = leftHeight;
+        }
+        else
+        {
+            NodeType *current = right, *parent = nullptr;
+            int currentHeight = rightHeight;
+            while (current->isRed || currentHeight > leftHeight)
+            {
+                if (!current->isRed)
+                    currentHeight--;
+                parent = current;
+                current = current->left;
+            }
+
+            linkPivot(pivot, left, current);
+            pivot->parent = parent;
+            parent->left = pivot;
+            root = right;
+            height = rightHeight;
+        }
+
+        for (NodeType *p = pivot->parent; p != nullptr; p = p->parent)
+            p->size = p->left->size + p->right->size + 1;
+
+        pivot->isRed = true;
+        if (insertFixUp(pivot))
+            height++;
+
+        NodeType *result = root;
+        root = savedRoot;
+        return result;
+    }
+
+    void linkPivot(NodeType *pivot, NodeType *left, NodeType *right)
+    {
+        pivot->left = left;
+        pivot->right = right;
+        if (left != nil)
+            left->parent = pivot;
+        if (right != nil)
+            right->parent = pivot;
+        pivot->size = left->size + right->size + 1;
+    }
+
+    /**
+     * Fungsi traversal di bawah menerima visitor dengan signature void visit(NodeType *node)
+     * Visitor adalah parameter template sehingga dapat di-inline (tanpa std::function),
+     * dan traversal berjalan melalui pointer parent tanpa rekursi
+     * Visitor tidak boleh mengubah struktur tree (insert / remove)
+     */
+
+    // Mengunjungi node dengan from <= nilai <= to secara terurut
+    template <typename Visit>
+    void findBetween(const T &from, const T &to, Visit visit)
+    {
+        for (Iterator it = lowerBound(from); it.node != nil && comparer.compare(it.node->value, to) <= 0; ++it)
+            visit(it.node);
+    }
+
+    template <typename Visit>
+    void inorder(NodeType *node, Visit visit)
+    {
+        if (node == nil)
             return;
+
+        NodeType *current = minimum(node);
+        while (true)
+        {
+            visit(current);
+
+            if (current->right != nil)
+            {
+                current = minimum(current->right);
+                continue;
+            }
+
+            // Naik sampai datang dari anak kiri, berhenti jika sudah kembali ke node
+            while (current != node && current == current->parent->right)
+                current = current->parent;
+            if (current == node)
+                return;
+            current = current->parent;
         }
-        visit(node);
-        preorder(node->left, visit);
-        preorder(node->right, visit);
     }
 
-    void postorder(NodeType *node, const std::function<void(NodeType *)> &visit)
+    template <typename Visit>
+    void preorder(NodeType *node, Visit visit)
     {
         if (node == nil)
+            return;
+
+        NodeType *current = node;
+        while (true)
         {
+            visit(current);
+
+            if (current->left != nil)
+            {
+                current = current->left;
+                continue;
+            }
+            if (current->right != nil)
+            {
+                current = current->right;
+                continue;
+            }
+
+            // Naik sampai menemukan anak kanan yang belum dikunjungi
+            while (current != node)
+            {
+                NodeType *parent = current->parent;
+                if (current == parent->left && parent->right != nil)
+                {
+                    current = parent->right;
+                    break;
+                }
+                current = parent;
+            }
+            if (current == node)
+                return;
+        }
+    }
+
+    template <typename Visit>
+    void postorder(NodeType *node, Visit visit)
+    {
+        if (node == nil)
             return;
+
+        NodeType *current = deepestFirst(node);
+        while (true)
+        {
+            visit(current);
+            if (current == node)
+                return;
+
+            NodeType *parent = current->parent;
+            if (current == parent->left && parent->right != nil)
+                current = deepestFirst(parent->right);
+            else
+                current = parent;
         }
+    }
 
-        postorder(node->left, visit);
-        postorder(node->right, visit);
-        visit(node);
+    // Node pertama dalam urutan postorder dari subtree node
+    NodeType *deepestFirst(NodeType *node)
+    {
+        while (true)
+        {
+            if (node->left != nil)
+                node = node->left;
+            else if (node->right != nil)
+                node = node->right;
+            else
+                return node;
+        }
     }
 
     int maxLevel(NodeType *node, int current)
@@ -415,6 +1351,9 @@ struct RBTree
 
         y->right = x;
         x->parent = y;
+
+        y->size = x->size;
+        x->size = x->left->size + x->right->size + 1;
     }
 
     void rotateLeft(NodeType *x)
@@ -441,9 +1380,13 @@ struct RBTree
 
         y->left = x;
         x->parent = y;
+
+        y->size = x->size;
+        x->size = x->left->size + x->right->size + 1;
     }
 
-    void insertFixUp(NodeType *node)
+    // Mengembalikan true jika root berubah dari merah menjadi hitam, yaitu black height tree bertambah satu
+    bool insertFixUp(NodeType *node)
     {
         while (node != root && node->parent->isRed)
         {
@@ -492,6 +1435,8 @@ struct RBTree
             }
         }
 
+        bool grown = root->isRed;
         root->isRed = false;
+        return grown;
     }
 };
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include "RBTree.hpp"
+#include "Utils.hpp"
+#include <string>
 
 struct IntCompare
 {
@@ -8,6 +10,68 @@ struct IntCompare
     }
 };
 
+struct StringCompare
+{
+    int compare(const std::string &a, const std::string &b)
+    {
+        return a.compare(b);
+    }
+};
+
+struct WStringCompare
+{
+    int compare(const std::wstring &a, const std::wstring &b)
+    {
+        return Utils::CompareWStringHalfInsensitive(a, b);
+    }
+};
+
+// Mengembalikan jumlah node hitam dari node ke nil, -1 jika sifat Red Black Tree dilanggar
+template <typename Tree>
+int blackHeight(Tree &tree, typename Tree::NodeType *node)
+{
+    if (node == tree.nil)
+        return 1;
+
+    if (node->isRed && (node->left->isRed || node->right->isRed))
+        return -1;
+
+    int left = blackHeight(tree, node->left);
+    int right = blackHeight(tree, node->right);
+    if (left == -1 || left != right)
+        return -1;
+
+    return left + (node->isRed ? 0 : 1);
+}
+
+// Mengembalikan true jika ukuran subtree di setiap node sesuai
+template <typename Tree>
+bool sizeValid(Tree &tree, typename Tree::NodeType *node)
+{
+    if (node == tree.nil)
+        return node->size == 0;
+
+    return node->size == node->left->size + node->right->size + 1 &&
+           sizeValid(tree, node->left) && sizeValid(tree, node->right);
+}
+
+// Traversal rekursif sebagai pembanding traversal tanpa rekursi
+template <typename Tree>
+void recursiveOrder(Tree &tree, typename Tree::NodeType *node, int order, std::vector<int> &out)
+{
+    if (node == tree.nil)
+        return;
+
+    if (order == 0)
+        out.push_back(node->value);
+    recursiveOrder(tree, node->left, order, out);
+    if (order == 1)
+        out.push_back(node->value);
+    recursiveOrder(tree, node->right, order, out);
+    if (order == 2)
+        out.push_back(node->value);
+}
+
 int main()
 {
 
@@ -25,4 +89,366 @@ int main()
         tree.remove(x);
         std::cout << "Remove " << x << ", depth " << tree.maxLevel(tree.root, 0) << std::endl;
     }
-}
\ No newline at end of file
+
+    for (int n = 0; n <= 1000; n++)
+    {
+        std::vector<int> values;
+        for (int x = 1; x <= n; x++)
+            values.push_back(x);
+
+        tree.buildFromSorted(std::move(values));
+        if (tree.count != size_t(n) || blackHeight(tree, tree.root) == -1 || tree.root->isRed)
+            std::cout << "Build from sorted " << n << " invalid" << std::endl;
+    }
+
+    std::cout << "Build from sorted 1000, depth " << tree.maxLevel(tree.root, 0) << std::endl;
+
+    for (int x = 1; x <= 1000; x += 2)
+        tree.remove(x);
+    for (int x = 2001; x <= 2500; x++)
+        tree.insert(std::move(x));
+
+    std::cout << "After update count " << tree.count << ", valid " << (blackHeight(tree, tree.root) != -1) << std::endl;
+
+    // Node yang dihapus dipakai ulang oleh insert berikutnya tanpa menambah chunk
+    size_t chunkCount = tree.allocator.chunks.size();
+    for (int x = 2001; x <= 2500; x++)
+        tree.remove(x);
+    for (int x = 3001; x <= 3500; x++)
+        tree.insert(std::move(x));
+    std::cout << "Pool reuse, chunk " << chunkCount << " -> " << tree.allocator.chunks.size() << std::endl;
+
+    // insertBulk ke tree kosong, merge dengan batch besar, dan insert biasa untuk batch kecil
+    RBTree<int, IntCompare> bulkTree;
+    std::vector<int> batch;
+    for (int x = 0; x < 3000; x++)
+        batch.push_back((x * 7919) % 3000 * 2);
+    bulkTree.insertBulk(std::move(batch));
+
+    int *stable = &bulkTree.findNode(1000)->value;
+    batch.clear();
+    for (int x = 0; x < 2000; x++)
+        batch.push_back(x * 3 + 1);
+    for (size_t i = 0; i < batch.size(); i++)
+        batch[i] = batch[i] % 2 == 0 ? batch[i] + 1 : batch[i];
+    bulkTree.insertBulk(std::move(batch));
+
+    bulkTree.insertBulk(std::vector<int>{100001, 100003});
+
+    int previous = -1;
+    bool ordered = true;
+    bulkTree.inorder(bulkTree.root, [&](RBNode<int> *node)
+                     {
+                         ordered = ordered && node->value > previous;
+                         previous = node->value;
+                     });
+    std::cout << "Bulk count " << bulkTree.count << ", valid " << (blackHeight(bulkTree, bulkTree.root) != -1 && ordered)
+              << ", pointer stable " << (stable == &bulkTree.findNode(1000)->value) << std::endl;
+
+    try
+    {
+        bulkTree.insertBulk(std::vector<int>{-5, 1000, 999999});
+    }
+    catch (const std::domain_error &)
+    {
+        std::cout << "Bulk duplicate rejected, count " << bulkTree.count << ", has -5 " << (bulkTree.findNode(-5) != bulkTree.nil) << std::endl;
+    }
+
+    RBTree<int, IntCompare, RBNodeAllocatorHeap<int>> heapTree;
+    for (int x = 1; x <= 1000; x++)
+        heapTree.insert(std::move(x));
+    for (int x = 1; x <= 1000; x += 3)
+        heapTree.remove(x);
+    std::cout << "Heap allocator count " << heapTree.count << ", valid " << (blackHeight(heapTree, heapTree.root) != -1) << std::endl;
+
+    // Nilai dengan alokasi sendiri, dijalankan dengan sanitizer untuk memeriksa kebocoran memori
+    RBTree<std::string, StringCompare> stringTree;
+    for (int x = 0; x < 5000; x++)
+        stringTree.insert(std::string(40, 'a') + std::to_string(x));
+    for (int x = 0; x < 5000; x += 2)
+        stringTree.remove(std::string(40, 'a') + std::to_string(x));
+    try
+    {
+        stringTree.insert(std::string(40, 'a') + "1");
+    }
+    catch (const std::domain_error &)
+    {
+        std::cout << "Duplicate rejected" << std::endl;
+    }
+    std::cout << "String tree count " << stringTree.count << ", valid " << (blackHeight(stringTree, stringTree.root) != -1) << std::endl;
+    stringTree.clear();
+    stringTree.insert(std::string("after clear"));
+    std::cout << "String tree after clear count " << stringTree.count << std::endl;
+
+    RBTree<int, IntCompare> iterTree;
+    std::cout << "Empty begin == end " << (iterTree.begin() == iterTree.end()) << std::endl;
+    std::vector<int> expected;
+    for (int x = 0; x < 2000; x++)
+    {
+        int value = (x * 7919) % 2000 * 3;
+        iterTree.insert(std::move(value));
+    }
+    for (int x = 0; x < 2000; x += 5)
+        iterTree.remove(x * 3);
+    for (int x = 0; x < 2000; x++)
+    {
+        if (x % 5 != 0)
+            expected.push_back(x * 3);
+    }
+
+    std::vector<int> forward(iterTree.begin(), iterTree.end());
+    std::vector<int> backward;
+    for (auto it = iterTree.end(); it != iterTree.begin();)
+        backward.push_back(*--it);
+    std::reverse(backward.begin(), backward.end());
+    std::cout << "Iterator forward " << (forward == expected) << ", backward " << (backward == expected)
+              << ", distance " << std::distance(iterTree.begin(), iterTree.end()) << std::endl;
+
+    bool traversalMatch = true;
+    for (int order = 0; order < 3; order++)
+    {
+        std::vector<int> reference, visited;
+        recursiveOrder(iterTree, iterTree.root, order, reference);
+        auto visit = [&](RBNode<int> *node)
+        { visited.push_back(node->value); };
+        if (order == 0)
+            iterTree.preorder(iterTree.root, visit);
+        else if (order == 1)
+            iterTree.inorder(iterTree.root, visit);
+        else
+            iterTree.postorder(iterTree.root, visit);
+        traversalMatch = traversalMatch && reference == visited;
+
+        // Traversal subtree tidak boleh keluar dari subtree
+        reference.clear();
+        visited.clear();
+        recursiveOrder(iterTree, iterTree.root->left, order, reference);
+        if (order == 0)
+            iterTree.preorder(iterTree.root->left, visit);
+        else if (order == 1)
+            iterTree.inorder(iterTree.root->left, visit);
+        else
+            iterTree.postorder(iterTree.root->left, visit);
+        traversalMatch = traversalMatch && reference == visited;
+    }
+    std::cout << "Traversal match " << traversalMatch << std::endl;
+
+    bool boundsMatch = true;
+    for (int value = -2; value <= 6002; value++)
+    {
+        auto lower = std::lower_bound(expected.begin(), expected.end(), value);
+        auto upper = std::upper_bound(expected.begin(), expected.end(), value);
+        auto treeLower = iterTree.lowerBound(value);
+        auto treeUpper = iterTree.upperBound(value);
+        boundsMatch = boundsMatch && (lower == expected.end() ? treeLower == iterTree.end() : *treeLower == *lower);
+        boundsMatch = boundsMatch && (upper == expected.end() ? treeUpper == iterTree.end() : *treeUpper == *upper);
+    }
+
+    std::vector<int> between;
+    iterTree.findBetween(100, 200, [&](RBNode<int> *node)
+                         { between.push_back(node->value); });
+    std::vector<int> expectedBetween(std::lower_bound(expected.begin(), expected.end(), 100), std::upper_bound(expected.begin(), expected.end(), 200));
+    std::vector<int> outside;
+    iterTree.findBetween(7000, 8000, [&](RBNode<int> *node)
+                         { outside.push_back(node->value); });
+    std::cout << "Bounds match " << boundsMatch << ", between match " << (between == expectedBetween)
+              << ", outside empty " << outside.empty() << std::endl;
+
+    int sum = 0;
+    for (int &value : iterTree)
+        sum += value;
+    auto found = std::find_if(iterTree.begin(), iterTree.end(), [](int value)
+                              { return value > 1000; });
+    std::cout << "Range-for sum " << sum << ", first above 1000 " << *found << std::endl;
+
+    // Order statistic: ukuran subtree harus tetap benar setelah insert, remove, dan insertBulk
+    RBTree<int, IntCompare> rankTree;
+    std::vector<int> rankValues;
+    bool rankValid = true;
+    for (int round = 0; round < 4; round++)
+    {
+        for (int x = 0; x < 500; x++)
+        {
+            int value = (x * 7919 + round * 131) % 4000;
+            if (rankTree.findNode(value) == rankTree.nil)
+                rankTree.insert(std::move(value));
+        }
+        for (int x = round; x < 4000; x += 7)
+            rankTree.remove(x);
+
+        std::vector<int> batch;
+        for (int x = 4000 + round * 300; x < 4000 + round * 300 + 300; x++)
+            batch.push_back(x);
+        rankTree.insertBulk(std::move(batch));
+
+        rankValues.assign(rankTree.begin(), rankTree.end());
+        rankValid = rankValid && sizeValid(rankTree, rankTree.root) && rankTree.root->size == rankTree.count;
+        for (size_t i = 0; i < rankValues.size(); i++)
+        {
+            rankValid = rankValid && rankTree.select(i)->value == rankValues[i];
+            rankValid = rankValid && rankTree.rank(rankValues[i]) == i && rankTree.upperRank(rankValues[i]) == i + 1;
+        }
+        rankValid = rankValid && rankTree.select(rankValues.size()) == rankTree.nil;
+        for (int value = -1; value < 5300; value += 17)
+        {
+            size_t lower = std::lower_bound(rankValues.begin(), rankValues.end(), value) - rankValues.begin();
+            size_t upper = std::upper_bound(rankValues.begin(), rankValues.end(), value) - rankValues.begin();
+            rankValid = rankValid && rankTree.rank(value) == lower && rankTree.upperRank(value) == upper;
+        }
+    }
+    std::cout << "Order statistic count " << rankTree.count << ", valid " << rankValid << std::endl;
+
+    // Hapus banyak nilai sekaligus: batch kecil dihapus satu per satu, batch besar disusun ulang
+    RBTree<int, IntCompare> manyTree;
+    std::vector<int> manyValues;
+    for (int x = 0; x < 6000; x++)
+        manyValues.push_back(x * 2);
+    manyTree.insertBulk(std::vector<int>(manyValues));
+    int *kept = &manyTree.findNode(2)->value;
+
+    std::vector<int> smallBatch = {9000, 5, 40, 11998};
+    size_t smallRemoved = manyTree.removeMany(smallBatch);
+    // Nilai ganjil tidak ada di tree dan dilewati
+    std::vector<int> largeBatch;
+    for (int x = 11997; x >= 100; x -= 3)
+        largeBatch.push_back(x);
+    size_t largeRemoved = manyTree.removeMany(largeBatch);
+
+    std::vector<int> manyExpected;
+    for (int value : manyValues)
+    {
+        bool inSmall = value == 9000 || value == 40 || value == 11998;
+        bool inLarge = value >= 100 && (11997 - value) % 3 == 0;
+        if (!inSmall && !inLarge)
+            manyExpected.push_back(value);
+    }
+    std::vector<int> manyFound(manyTree.begin(), manyTree.end());
+    bool manyValid = manyFound == manyExpected && blackHeight(manyTree, manyTree.root) != -1 &&
+                     sizeValid(manyTree, manyTree.root) && manyTree.count == manyExpected.size() && &manyTree.findNode(2)->value == kept;
+    std::cout << "Remove many " << smallRemoved << " + " << largeRemoved << ", count " << manyTree.count << ", valid " << manyValid << std::endl;
+
+    // Melepas rentang dengan split dan join, dibandingkan dengan vector terurut
+    RBTree<int, IntCompare> rangeTree;
+    std::vector<int> rangeValues;
+    for (int x = 0; x < 20000; x++)
+    {
+        int value = static_cast<int>(x * 7919LL % 20011);
+        rangeTree.insert(int(value));
+        rangeValues.push_back(value);
+    }
+    // Nilai di luar semua rentang yang dilepas
+    rangeTree.insert(25000);
+    rangeValues.push_back(25000);
+    std::sort(rangeValues.begin(), rangeValues.end());
+    int *rangeKept = &rangeTree.findNode(25000)->value;
+
+    bool rangeValid = true;
+    size_t extracted = 0;
+    for (int x = 0; x < 300; x++)
+    {
+        int from = static_cast<int>(x * 104729LL % 20011);
+        int to = from + (x % 7 == 0 ? -5 : x % 60);
+        auto first = std::lower_bound(rangeValues.begin(), rangeValues.end(), from);
+        auto last = std::upper_bound(rangeValues.begin(), rangeValues.end(), to);
+        std::vector<int> expected(first, last > first ? last : first);
+        if (last > first)
+            rangeValues.erase(first, last);
+
+        std::vector<int> values = rangeTree.extractRange(from, to);
+        extracted += values.size();
+        rangeValid = rangeValid && values == expected && rangeTree.count == rangeValues.size();
+        if (x % 20 == 0)
+            rangeValid = rangeValid && blackHeight(rangeTree, rangeTree.root) != -1 && sizeValid(rangeTree, rangeTree.root) &&
+                         std::vector<int>(rangeTree.begin(), rangeTree.end()) == rangeValues;
+    }
+    // Rentang iterator sampai sebelum nilai terbesar, node yang tersisa tidak dipindahkan
+    std::vector<int> tail = rangeTree.extractRange(rangeTree.lowerBound(19000), rangeTree.lowerBound(25000));
+    rangeValid = rangeValid && !tail.empty() && tail.front() >= 19000 && tail.back() < 25000;
+    rangeValues.erase(std::lower_bound(rangeValues.begin(), rangeValues.end(), 19000), rangeValues.end() - 1);
+    std::vector<int> rangeBackward;
+    for (auto it = rangeTree.end(); it != rangeTree.begin();)
+        rangeBackward.push_back(*--it);
+    rangeValid = rangeValid && std::vector<int>(rangeTree.begin(), rangeTree.end()) == rangeValues &&
+                 std::vector<int>(rangeBackward.rbegin(), rangeBackward.rend()) == rangeValues && blackHeight(rangeTree, rangeTree.root) != -1 &&
+                 sizeValid(rangeTree, rangeTree.root) && rangeTree.root->parent == nullptr && &rangeTree.findNode(25000)->value == rangeKept;
+    size_t remaining = rangeTree.count;
+    rangeValid = rangeValid && rangeTree.extractRange(-1, 30000).size() == remaining && rangeTree.count == 0 && rangeTree.root == rangeTree.nil;
+    std::cout << "Extract range " << extracted << " + " << tail.size() << " + " << remaining << ", valid " << rangeValid << std::endl;
+
+    // Prefix dengan urutan CompareWStringHalfInsensitive
+    RBTree<std::wstring, WStringCompare> wordTree;
+    std::vector<std::wstring> words;
+    const wchar_t letters[] = L"aAsSuU";
+    for (int x = 0; x < 3000; x++)
+    {
+        std::wstring word;
+        for (int n = x; word.size() < static_cast<size_t>(1 + x % 5); n /= 6)
+            word.push_back(letters[(n + word.size() * 7) % 6]);
+        if (wordTree.findNode(word) == wordTree.nil)
+        {
+            words.push_back(word);
+            wordTree.insert(std::move(word));
+        }
+    }
+    std::sort(words.begin(), words.end(), [](const std::wstring &a, const std::wstring &b)
+              { return Utils::CompareWStringHalfInsensitive(a, b) < 0; });
+
+    bool prefixMatch = true;
+    size_t prefixTotal = 0;
+    for (const std::wstring &prefix : {std::wstring(L""), std::wstring(L"s"), std::wstring(L"S"), std::wstring(L"su"), std::wstring(L"sUa"), std::wstring(L"AAAAAA"), std::wstring(L"z")})
+    {
+        std::vector<std::wstring> expectedWords;
+        for (const std::wstring &word : words)
+        {
+            if (Utils::StartsWith(word, prefix))
+                expectedWords.push_back(word);
+        }
+
+        auto range = wordTree.prefixRange(prefix, [&](const std::wstring &word)
+                                          { return Utils::StartsWith(word, prefix); });
+        std::vector<std::wstring> found(range.begin(), range.end());
+        prefixMatch = prefixMatch && found == expectedWords &&
+                      wordTree.indexOf(range.end()) - wordTree.indexOf(range.begin()) == expectedWords.size();
+        if (!expectedWords.empty())
+            prefixMatch = prefixMatch && words[wordTree.indexOf(range.begin())] == expectedWords[0];
+        prefixTotal += found.size();
+    }
+
+    // Berhenti setelah 3 hasil pertama
+    std::vector<std::wstring> firstThree;
+    for (const std::wstring &word : wordTree.prefixRange(L"s", [](const std::wstring &word)
+                                                         { return Utils::StartsWith(word, L"s"); }))
+    {
+        if (firstThree.size() == 3)
+            break;
+        firstThree.push_back(word);
+    }
+    std::cout << "Prefix match " << prefixMatch << ", total " << prefixTotal << ", first three " << firstThree.size() << std::endl;
+
+    // Kunci urutan harus memberikan urutan yang sama dengan CompareWStringHalfInsensitive nama lalu ID
+    const wchar_t keyLetters[] = {L'a', L'A', L'z', L'Z', L'0', L' ', L'.', L'~', 0x00E9, 0x00C9, 0x4E2D, 0xFF21, 0xFF41};
+    auto sign = [](int value)
+    { return (value > 0) - (value < 0); };
+    bool keyMatch = true;
+    for (int x = 0; x < 200000; x++)
+    {
+        std::wstring name[2], id[2];
+        for (int side = 0; side < 2; side++)
+        {
+            // Nama kedua sering berawalan nama pertama agar kasus awalan ikut diperiksa
+            if (side == 1 && x % 2 == 0)
+                name[1] = name[0].substr(0, x % (name[0].size() + 1));
+            for (int i = 0; i < (x / 3 + side) % 5; i++)
+                name[side] += keyLetters[(x * 7 + i * 13 + side * 5) % 13];
+            id[side] = keyLetters[(x + side) % 3];
+        }
+
+        int expected = Utils::CompareWStringHalfInsensitive(name[0], name[1]);
+        if (expected == 0)
+            expected = Utils::CompareWStringHalfInsensitive(id[0], id[1]);
+        keyMatch = keyMatch && sign(expected) == sign(Utils::CompareSortKey(Utils::SortKey(name[0], id[0]), Utils::SortKey(name[1], id[1])));
+    }
+    for (size_t i = 1; i < words.size(); i++)
+        keyMatch = keyMatch && Utils::CompareSortKey(Utils::SortKey(words[i - 1]), Utils::SortKey(words[i])) < 0;
+    std::cout << "Sort key match " << keyMatch << std::endl;
+}
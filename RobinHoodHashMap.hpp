@@ -1,6 +1,7 @@
 #pragma once
 
 #include <iostream>
+#include <vector>
 
 /*
     Implementasi Hash Table Open Adressing dengan variasi Linear Probing dan Robin Hood
@@ -227,6 +228,30 @@ struct RobinHoodHashMap
         }
     }
 
+    // Menghapus semua elemen dan mengembalikan bucket ke ukuran minimal
+    void clear()
+    {
+        delete[] buckets;
+        buckets = nullptr;
+        bucketSize = 0;
+        count = 0;
+        resize(minBucketSize);
+    }
+
+    /**
+     * Memperbesar bucket sekaligus agar bisa menampung n elemen tanpa resize berulang kali
+     * Digunakan sebelum memasukkan banyak elemen yang jumlahnya sudah diketahui
+     */
+    void reserve(size_t n)
+    {
+        size_t newSize = bucketSize;
+        while (approx85Percent(newSize) <= n)
+            newSize *= 2;
+
+        if (newSize != bucketSize)
+            resize(newSize);
+    }
+
     void put(const K& key, const V& value)
     {
         size_t threshold = approx85Percent(bucketSize);
@@ -241,11 +266,62 @@ struct RobinHoodHashMap
         internalInsert(hasher.hash(key), std::move(keyC), std::move(valueC));
     }
 
+    /**
+     * Memasukkan banyak nilai sekaligus dengan kunci keyOf(value)
+     * Bucket diperbesar sekali di awal sehingga tidak ada resize di tengah
+     */
+    template <typename KeyOf>
+    void putMany(const std::vector<V> &values, KeyOf keyOf)
+    {
+        reserve(count + values.size());
+
+        for (const V &value : values)
+        {
+            K keyC = keyOf(value);
+            V valueC = value;
+            uint64_t hash = hasher.hash(keyC);
+            internalInsert(hash, std::move(keyC), std::move(valueC));
+        }
+    }
+
     /**
      * Algoritmanya mirip get
      * Setelah menemukan kunci yang dihapus, maka kunci setelahnya dengan psl > 0, akan digeser ke kiri 
      */
     bool remove(const K& key) {
+        if (!internalRemove(key))
+            return false;
+
+        if (count > minBucketSize && count < approx40Percent(bucketSize)) {
+            resize(bucketSize / 2);
+        }
+
+        return true;
+    }
+
+    /**
+     * Menghapus kunci keyOf(item) untuk setiap item, mengembalikan jumlah kunci yang dihapus
+     * Bucket tidak diperkecil di tengah penghapusan, tetapi sekali di akhir langsung ke ukuran yang sesuai
+     */
+    template <typename Item, typename KeyOf>
+    size_t removeMany(const std::vector<Item> &items, KeyOf keyOf)
+    {
+        size_t removed = 0;
+        for (const Item &item : items)
+            removed += internalRemove(keyOf(item));
+
+        size_t newSize = bucketSize;
+        while (count > minBucketSize && count < approx40Percent(newSize) && newSize / 2 >= minBucketSize)
+            newSize /= 2;
+
+        if (newSize != bucketSize)
+            resize(newSize);
+
+        return removed;
+    }
+
+    // Menghapus kunci tanpa memperkecil bucket
+    bool internalRemove(const K& key) {
         const uint64_t hash = hasher.hash(key);
 
         size_t currentPsl = 0, i = hash % bucketSize;
@@ -280,10 +356,6 @@ struct RobinHoodHashMap
                 bucket = nextBucket;
             }
 
-            if (count > minBucketSize && count < approx40Percent(bucketSize)) {
-                resize(bucketSize / 2);
-            }
-
             return true;
         }
     }
@@ -50,4 +50,31 @@ int main()
         std::cout << "Remove " << i << " > ";
         test();
     }
-}
\ No newline at end of file
+
+    // Masukkan dan hapus banyak kunci sekaligus, bucket hanya diresize sekali untuk setiap batch
+    std::vector<int> many;
+    for (int i = 0; i < 10000; i++)
+        many.push_back(i);
+    RobinHoodHashMap<int, int, IntHasher> manyHash;
+    manyHash.putMany(many, [](int value)
+                     { return value; });
+    size_t grownSize = manyHash.bucketSize;
+
+    std::vector<int> removeKeys;
+    for (int i = 0; i < 10000; i++)
+    {
+        if (i % 10 != 0)
+            removeKeys.push_back(i);
+    }
+    removeKeys.push_back(20000);
+    size_t removed = manyHash.removeMany(removeKeys, [](int key)
+                                         { return key; });
+
+    bool manyValid = removed == 9000 && manyHash.count == 1000;
+    for (int i = 0; i < 10000; i++)
+    {
+        int *value = manyHash.get(i);
+        manyValid = manyValid && (i % 10 == 0 ? value != nullptr && *value == i : value == nullptr);
+    }
+    std::cout << "Many count " << manyHash.count << ", bucket " << grownSize << " -> " << manyHash.bucketSize << ", valid " << manyValid << std::endl;
+}
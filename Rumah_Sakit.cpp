@@ -8,6 +8,7 @@
 #include "TopKLargest.hpp"
 #include "UIUtils.hpp"
 #include "Timer.hpp"
+#include "Snapshot.hpp"
 #include <sstream>
 #include <iomanip>
 
@@ -38,6 +39,8 @@ struct HospitalPatient
     std::wstring id, name;
     PatientGroup group;
     SYSTEMTIME start, end;
+    // Kunci urutan nama lalu ID, diisi UpdateSortKey setiap nama atau ID berubah
+    std::string sortKey;
 
     int GetDayPrice()
     {
@@ -55,21 +58,28 @@ struct HospitalPatient
     }
 };
 
+void UpdateSortKey(HospitalPatient &patient)
+{
+    patient.sortKey = Utils::SortKey(patient.name, patient.id);
+}
+
+// Sama dengan CompareWStringHalfInsensitive nama lalu ID, melalui kunci urutan
 struct HospitalPatientNameComparer
 {
     int compare(const HospitalPatient &a, const HospitalPatient &b)
     {
-        int cmp = Utils::CompareWStringHalfInsensitive(a.name, b.name);
-
-        if (cmp != 0)
-        {
-            return cmp;
-        }
-
-        return Utils::CompareWStringHalfInsensitive(a.id, b.id);
+        return Utils::CompareSortKey(a.sortKey, b.sortKey);
     }
 };
 
+// Pasien batas untuk pencarian rentang nama
+HospitalPatient HospitalPatientBound(const std::wstring &id, const std::wstring &name)
+{
+    HospitalPatient patient{id, name};
+    UpdateSortKey(patient);
+    return patient;
+}
+
 struct HospitalPatientDurationReverseComparer
 {
     int compare(HospitalPatient *a, HospitalPatient *b)
@@ -92,6 +102,12 @@ struct HospitalPatientIDHasher
     }
 };
 
+// Kunci hash table untuk putMany dan removeMany
+const std::wstring &HospitalPatientID(const HospitalPatient &patient)
+{
+    return patient.id;
+}
+
 std::wstring lastId = L"000000000";
 RBTree<HospitalPatient, HospitalPatientNameComparer> tree, deleteHistoryTree;
 RobinHoodHashMap<std::wstring, HospitalPatient, HospitalPatientIDHasher> hashTable;
@@ -122,8 +138,12 @@ namespace AddWindow
     {
         lastId = patient.id;
 
+        // List yang mengambil baris langsung dari tree tidak boleh dibaca saat tree diubah
+        ClearAllList();
+
         Timer t;
         t.start();
+        UpdateSortKey(patient);
         hashTable.put(patient.id, patient);
         tree.insert(std::move(patient));
         t.end();
@@ -253,8 +273,15 @@ LRESULT OnAddClick(UI::CallbackParam param)
     return 0;
 }
 
+/**
+ * Baris diambil langsung dari tree dengan select jika tree diisi (urutan inorder mulai dari treeFirst),
+ * sehingga tidak perlu menyalin pointer seluruh node setiap kali refresh
+ * Urutan lain (preorder, postorder, top K) tetap disalin ke items
+ */
 struct PatientListView : UI::VListView
 {
+    RBTree<HospitalPatient, HospitalPatientNameComparer> *tree = nullptr;
+    size_t treeFirst = 0;
     std::vector<HospitalPatient *> items;
 
     void Create(UI::Window *window, HWND hParent, POINT pos, SIZE size) override
@@ -274,9 +301,34 @@ struct PatientListView : UI::VListView
         InsertColumn(L"Biaya Total", 200);
     }
 
+    HospitalPatient *GetItem(int row)
+    {
+        if (tree != nullptr)
+            return &tree->select(treeFirst + row)->value;
+        return items[row];
+    }
+
+    // Menampilkan count nilai dari source mulai dari index first (inorder)
+    void ShowTree(RBTree<HospitalPatient, HospitalPatientNameComparer> *source, size_t first, size_t count)
+    {
+        SetRowCount(0);
+        std::vector<HospitalPatient *>().swap(items);
+        tree = source;
+        treeFirst = first;
+        SetRowCount(count);
+    }
+
+    // Menampilkan isi items
+    void ShowItems()
+    {
+        SetRowCount(0);
+        tree = nullptr;
+        SetRowCount(items.size());
+    }
+
     const std::wstring OnGetItem(int row, int column) override
     {
-        HospitalPatient *patient = items[row];
+        HospitalPatient *patient = GetItem(row);
         if (column == 0)
             return patient->id;
         if (column == 1)
@@ -314,34 +366,42 @@ namespace TabHistoryDelete
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Memuat data");
         progress.SetWaiting(true);
 
         listView.SetRowCount(0);
-        listView.items.resize(deleteHistoryTree.count);
         int type = comboType.GetSelectedIndex();
 
         Timer t;
         t.start();
-        size_t current = 0;
-        auto visitor = [&](RBNode<HospitalPatient> *node)
+        if (type == 1)
         {
-            listView.items[current] = &node->value;
-            current++;
-        };
+            listView.ShowTree(&deleteHistoryTree, 0, deleteHistoryTree.count);
+        }
+        else
+        {
+            listView.items.resize(deleteHistoryTree.count);
+            size_t current = 0;
+            auto visitor = [&](RBNode<HospitalPatient> *node)
+            {
+                listView.items[current] = &node->value;
+                current++;
+            };
 
-        if (type == 0)
-            deleteHistoryTree.preorder(deleteHistoryTree.root, visitor);
-        else if (type == 1)
-            deleteHistoryTree.inorder(deleteHistoryTree.root, visitor);
-        else if (type == 2)
-            deleteHistoryTree.postorder(deleteHistoryTree.root, visitor);
+            if (type == 0)
+                deleteHistoryTree.preorder(deleteHistoryTree.root, visitor);
+            else if (type == 2)
+                deleteHistoryTree.postorder(deleteHistoryTree.root, visitor);
+            listView.ShowItems();
+        }
 
         t.end();
 
-        listView.SetRowCount(listView.items.size());
         message.ReplaceLastMessage(L"Data dimuat dalam " + t.durationStr());
         progress.SetWaiting(false);
         SetEnable(true);
@@ -351,7 +411,7 @@ namespace TabHistoryDelete
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     void DoRestore()
@@ -362,20 +422,17 @@ namespace TabHistoryDelete
         std::vector<HospitalPatient> list;
         for (int v : listView.GetSelectedIndex())
         {
-            list.push_back(*listView.items[v]);
+            list.push_back(*listView.GetItem(v));
         }
 
-        listView.SetRowCount(0);
+        ClearAllList();
 
         Timer t;
         t.start();
-        for (HospitalPatient &patient : list)
-        {
-            deleteHistoryTree.remove(patient);
-
-            hashTable.put(patient.id, patient);
-            tree.insert(std::move(patient));
-        }
+        // Seluruh data yang dipilih diproses sekaligus di setiap struktur
+        deleteHistoryTree.removeMany(list);
+        hashTable.putMany(list, HospitalPatientID);
+        tree.insertBulk(std::move(list));
         t.end();
 
         progress.SetWaiting(false);
@@ -388,7 +445,7 @@ namespace TabHistoryDelete
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoRestore);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -441,6 +498,36 @@ void DoRemove(HospitalPatient &&patient, HWND window)
     deleteHistoryTree.insert(std::move(patient));
 }
 
+/**
+ * Menghapus banyak data sekaligus: setiap struktur diproses sekali untuk seluruh data
+ * Tree disusun ulang sekali dan hash table diperkecil sekali, bukan setiap data
+ */
+void DoRemoveMany(std::vector<HospitalPatient> &&patients, HWND window)
+{
+    if (tree.removeMany(patients) != patients.size())
+        MessageBoxA(window, "Penghapusan di RBTree gagal", "Gagal", MB_OK);
+
+    if (hashTable.removeMany(patients, HospitalPatientID) != patients.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    deleteHistoryTree.insertBulk(std::move(patients));
+}
+
+/**
+ * Menghapus seluruh data dalam rentang tree sekaligus
+ * Rentang dilepas dari tree dengan split dan join tanpa menghapus node satu per satu,
+ * lalu data yang dilepas dihapus dari hash table dan dimasukkan ke riwayat sekaligus
+ */
+void DoRemoveRange(RBTree<HospitalPatient, HospitalPatientNameComparer>::Range range, HWND window)
+{
+    std::vector<HospitalPatient> patients = tree.extractRange(range.begin(), range.end());
+
+    if (hashTable.removeMany(patients, HospitalPatientID) != patients.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    deleteHistoryTree.insertBulk(std::move(patients));
+}
+
 void DoRemoveByListViewSelection(PatientListView *list, UI::ProgressBar *progress, UI::LabelWorkMessage *message)
 {
     progress->SetWaiting(true);
@@ -448,16 +535,13 @@ void DoRemoveByListViewSelection(PatientListView *list, UI::ProgressBar *progres
 
     std::vector<HospitalPatient> selected;
     for (int v : list->GetSelectedIndex())
-        selected.push_back(*list->items[v]);
+        selected.push_back(*list->GetItem(v));
 
     ClearAllList();
 
     Timer t;
     t.start();
-    for (HospitalPatient &patient : selected)
-    {
-        DoRemove(std::move(patient), list->_window->hwnd);
-    }
+    DoRemoveMany(std::move(selected), list->_window->hwnd);
     t.end();
 
     message->ReplaceLastMessage(L"Penghapusan selesai dalam " + t.durationStr() + L". Penghapusan mungkin terlihat lama karena proses mendapatkan pilihan dari UI");
@@ -475,7 +559,7 @@ void CopyIDByListViewSelection(PatientListView *list)
         if (selections.size() > 1)
             throw std::domain_error("Pilihan lebih dari 1");
 
-        Utils::CopyToClipboard(list->items[selections[0]]->id);
+        Utils::CopyToClipboard(list->GetItem(selections[0])->id);
     }
     catch (std::domain_error const &e)
     {
@@ -503,6 +587,9 @@ namespace TabDetail
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Mencari data");
@@ -549,11 +636,12 @@ namespace TabDetail
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     void DoDelete()
     {
+        ClearAllList();
         progress.SetWaiting(true);
         message.ReplaceLastMessage(L"Menghapus data");
 
@@ -574,7 +662,7 @@ namespace TabDetail
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -650,6 +738,9 @@ namespace TabLongestDuration
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Memproses data");
@@ -674,7 +765,7 @@ namespace TabLongestDuration
         }
         t.end();
 
-        listView.SetRowCount(realCount);
+        listView.ShowItems();
         message.ReplaceLastMessage(L"Data dimuat dalam " + t.durationStr());
         progress.SetWaiting(false);
         SetEnable(true);
@@ -684,7 +775,7 @@ namespace TabLongestDuration
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     void DoDelete()
@@ -697,7 +788,7 @@ namespace TabLongestDuration
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -761,7 +852,7 @@ namespace TabFindRange
     UI::ProgressBar progress;
     UI::LabelWorkMessage message;
     UI::Label labelFrom, labelTo;
-    UI::Button btnFind, btnCopyID, btnAdd, btnDelete;
+    UI::Button btnFind, btnCopyID, btnAdd, btnDelete, btnDeleteRange;
     UI::TextBox textBoxFrom, textBoxTo;
     PatientListView listView;
 
@@ -773,28 +864,56 @@ namespace TabFindRange
         btnCopyID.SetEnable(enable);
         btnAdd.SetEnable(enable);
         btnDelete.SetEnable(enable);
+        btnDeleteRange.SetEnable(enable);
         listView.SetEnable(enable);
     }
 
+    // Rentang yang ditampilkan dan dihapus tab ini, batasnya dicari dalam O(log n)
+    RBTree<HospitalPatient, HospitalPatientNameComparer>::Range FindRange(const std::wstring &from, const std::wstring &to)
+    {
+        if (to.empty())
+        {
+            // Batas akhir kosong: semua data dengan nama berawalan batas awal
+            return tree.prefixRange(HospitalPatientBound(L".", from), [&](const HospitalPatient &value)
+                                    { return Utils::StartsWith(value.name, from); });
+        }
+
+        return {tree.lowerBound(HospitalPatientBound(L".", from)), tree.upperBound(HospitalPatientBound(L":", to))};
+    }
+
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
+    // Batas dan jumlah hasil yang terakhir ditampilkan
+    // "Hapus Semua Hasil" menghapus rentang ini, bukan isi text box saat tombol ditekan
+    struct ShownRange
+    {
+        std::wstring from, to;
+        size_t count;
+        // WorkerThread::WriteVersion saat hasil ditampilkan
+        uint64_t version;
+    };
+    // Ditulis DoRefresh di thread pool baca dan dibaca thread UI
+    WorkerThread::Published<ShownRange> shown;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Mencari data");
         progress.SetWaiting(true);
 
         listView.SetRowCount(0);
-        listView.items.clear();
         std::wstring from = textBoxFrom.getText(), to = textBoxTo.getText();
 
+        // Index batas rentang dicari dengan indexOf, baris diambil dari tree saat ditampilkan
         Timer t;
         t.start();
-        tree.findBetween(HospitalPatient{L".", from}, HospitalPatient{L":", to},
-                         [&](RBNode<HospitalPatient> *node)
-                         {
-                             listView.items.push_back(&node->value);
-                         });
+        auto range = FindRange(from, to);
+        size_t first = tree.indexOf(range.begin());
+        size_t last = tree.indexOf(range.end());
         t.end();
 
-        listView.SetRowCount(listView.items.size());
+        listView.ShowTree(&tree, first, last > first ? last - first : 0);
+        shown.Set({from, to, last > first ? last - first : 0, WorkerThread::WriteVersion()});
         message.ReplaceLastMessage(L"Data dimuat dalam " + t.durationStr());
         progress.SetWaiting(false);
         SetEnable(true);
@@ -804,7 +923,7 @@ namespace TabFindRange
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     void DoDelete()
@@ -817,7 +936,57 @@ namespace TabFindRange
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
+        EnqueueRefreshAll(&window);
+        return 0;
+    }
+
+    // Menghapus seluruh hasil pencarian rentang, bukan hanya yang dipilih
+    void DoDeleteRange(const ShownRange &range)
+    {
+        progress.SetWaiting(true);
+        message.ReplaceLastMessage(L"Menghapus rentang");
+
+        // Hanya rentang yang dikonfirmasi yang dihapus, batal jika data berubah setelah hasil ditampilkan
+        auto current = FindRange(range.from, range.to);
+        size_t first = tree.indexOf(current.begin());
+        size_t last = tree.indexOf(current.end());
+        if (range.version != WorkerThread::WriteVersion() || (last > first ? last - first : 0) != range.count)
+        {
+            message.ReplaceLastMessage(L"Data berubah setelah hasil ditampilkan, tidak ada data yang dihapus");
+            UIUtils::MessageSetWait(&message, false);
+            progress.SetWaiting(false);
+            return;
+        }
+
+        ClearAllList();
+
+        Timer t;
+        t.start();
+        DoRemoveRange(current, window.hwnd);
+        t.end();
+
+        message.ReplaceLastMessage(L"Penghapusan rentang selesai dalam " + t.durationStr());
+        progress.SetWaiting(false);
+        UIUtils::MessageSetWait(&message, false);
+    }
+
+    LRESULT OnDeleteRangeClick(UI::CallbackParam param)
+    {
+        ShownRange range = shown.Get();
+        if (range.count == 0)
+            return 0;
+
+        std::wstring confirm = L"Hapus " + std::to_wstring(range.count) + L" data hasil pencarian? Data dapat dikembalikan dari riwayat penghapusan.";
+        if (MessageBoxW(window.hwnd, confirm.c_str(), L"Hapus Semua Hasil", MB_OKCANCEL | MB_ICONWARNING) != IDOK)
+            return 0;
+
+        // Rentang disalin ke tugas karena refresh berikutnya dapat mengganti rentang yang ditampilkan sebelum tugas berjalan
+        UIUtils::MessageSetWait(&message);
+        SetEnable(false);
+        WorkerThread::EnqueueWork([range]()
+                                  { DoDeleteRange(range); });
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -850,6 +1019,9 @@ namespace TabFindRange
         btnDelete.SetText(L"Hapus");
         btnDelete.commandListener = OnDeleteClick;
 
+        btnDeleteRange.SetText(L"Hapus Semua Hasil");
+        btnDeleteRange.commandListener = OnDeleteRangeClick;
+
         window.controlsLayout = {{UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &labelFrom),
                                   UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &textBoxFrom),
                                   UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &labelTo),
@@ -861,7 +1033,8 @@ namespace TabFindRange
                                  {UI::EmptyCell(UI::SIZE_FILL, UI::SIZE_DEFAULT),
                                   UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &btnCopyID),
                                   UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &btnAdd),
-                                  UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &btnDelete)}};
+                                  UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &btnDelete),
+                                  UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &btnDeleteRange)}};
         UI::LayoutControls(&window, true);
 
         return 0;
@@ -893,33 +1066,41 @@ namespace TabAllPatient
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         message.ReplaceLastMessage(L"Memuat data");
         progress.SetWaiting(true);
 
         listView.SetRowCount(0);
-        listView.items.resize(tree.count);
         int selectedIndex = comboType.GetSelectedIndex();
 
         Timer t;
         t.start();
-        size_t current = 0;
-        auto visitor = [&](RBNode<HospitalPatient> *node)
+        if (selectedIndex == 1)
         {
-            listView.items[current] = &node->value;
-            current++;
-        };
-
-        if (selectedIndex == 0)
-            tree.preorder(tree.root, visitor);
-        else if (selectedIndex == 1)
-            tree.inorder(tree.root, visitor);
-        else if (selectedIndex == 2)
-            tree.postorder(tree.root, visitor);
+            listView.ShowTree(&tree, 0, tree.count);
+        }
+        else
+        {
+            listView.items.resize(tree.count);
+            size_t current = 0;
+            auto visitor = [&](RBNode<HospitalPatient> *node)
+            {
+                listView.items[current] = &node->value;
+                current++;
+            };
+
+            if (selectedIndex == 0)
+                tree.preorder(tree.root, visitor);
+            else if (selectedIndex == 2)
+                tree.postorder(tree.root, visitor);
+            listView.ShowItems();
+        }
         t.end();
 
-        listView.SetRowCount(tree.count);
         message.ReplaceLastMessage(L"Data dimuat dalam " + t.durationStr());
         progress.SetWaiting(false);
         SetEnable(true);
@@ -929,7 +1110,7 @@ namespace TabAllPatient
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     void DoDelete()
@@ -942,7 +1123,7 @@ namespace TabAllPatient
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -1006,16 +1187,86 @@ namespace MainWindow
     UI::ProgressBar progress;
     UI::Tabs tabs;
 
+    const std::string csvPath = "data/Rumah_Sakit.csv";
+    const std::string snapshotPath = "data/Rumah_Sakit.snapshot";
+    // Naikkan jika isi HospitalPatient atau HospitalPatientNameComparer berubah
+    const uint32_t snapshotRecordVersion = 1;
+
+    void WritePatient(SnapshotWriter &writer, const HospitalPatient &patient)
+    {
+        writer.writeWString(patient.id);
+        writer.writeWString(patient.name);
+        writer.writePod(patient.group);
+        writer.writePod(patient.start);
+        writer.writePod(patient.end);
+    }
+
+    HospitalPatient ReadPatient(SnapshotReader &reader)
+    {
+        HospitalPatient patient;
+        patient.id = reader.readWString();
+        patient.name = reader.readWString();
+        patient.group = reader.readPod<PatientGroup>();
+        patient.start = reader.readPod<SYSTEMTIME>();
+        patient.end = reader.readPod<SYSTEMTIME>();
+        UpdateSortKey(patient);
+        return patient;
+    }
+
+    // Baris CSV yang formatnya salah pada pemuatan terakhir, dilewati tanpa membatalkan pemuatan
+    std::vector<CSVQuarantinedRow> quarantine;
+
+    // Keterangan baris yang dilewati untuk status bar, kosong jika tidak ada
+    std::wstring QuarantineStr()
+    {
+        if (quarantine.empty())
+            return L"";
+
+        return L", " + std::to_wstring(quarantine.size()) + L" baris dilewati (baris " +
+               std::to_wstring(quarantine.front().line) + L": " +
+               std::wstring(quarantine.front().message.begin(), quarantine.front().message.end()) + L")";
+    }
+
+    bool LoadSnapshot(const SnapshotSource &source)
+    {
+        if (!LoadTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, ReadPatient))
+            return false;
+
+        hashTable.reserve(tree.count);
+        tree.inorder(tree.root, [&](RBNode<HospitalPatient> *node)
+                     {
+                         if (node->value.id > lastId)
+                             lastId = node->value.id;
+                         hashTable.put(node->value.id, node->value);
+                     });
+        return true;
+    }
+
     void DoLoad()
     {
         progress.SetWaiting(true);
-        statusBar.SetText(1, L"Memuat data dari CSV");
 
         Timer t;
+        SnapshotSource source;
+        bool hasSource = source.read(csvPath);
+
+        statusBar.SetText(1, L"Memuat data dari snapshot");
+        t.start();
+        if (hasSource && LoadSnapshot(source))
+        {
+            t.end();
+            statusBar.SetText(1, L"Data dimuat dari snapshot dalam " + t.durationStr());
+            progress.SetWaiting(false);
+            return;
+        }
+
+        statusBar.SetText(1, L"Memuat data dari CSV");
         t.start();
-        CSVReader<CSVReaderIOBuffSync> reader("data/Rumah_Sakit.csv", ',');
+        CSVReader<CSVReaderIOMapped> reader(csvPath, ',');
 
         reader.startRead();
+        reader.projection = true;
+        reader.lenient = true;
 
         int idIndex = reader.findHeaderIndex("ID");
         int nameIndex = reader.findHeaderIndex("Name");
@@ -1023,23 +1274,43 @@ namespace MainWindow
         int startIndex = reader.findHeaderIndex("StartDate");
         int endIndex = reader.findHeaderIndex("EndDate");
 
-        while (reader.readData())
+        // Tree dibangun sekaligus setelah seluruh baris dibaca
+        std::vector<HospitalPatient> patients;
+        reader.readParallel<HospitalPatient>(
+            std::thread::hardware_concurrency(),
+            [&](const std::vector<Utils::StringView> &data)
+            {
+                HospitalPatient patient;
+                Utils::stringviewsToWstrings(data, {{idIndex, &patient.id},
+                                                    {nameIndex, &patient.name}});
+                patient.group = CSVField::toEnum<PatientGroup>(data, groupIndex, PatientGroupName);
+                patient.start = CSVField::toDate(data, startIndex);
+                patient.end = CSVField::toDate(data, endIndex);
+                UpdateSortKey(patient);
+                return patient;
+            },
+            [&](HospitalPatient &&patient)
+            {
+                if (patient.id > lastId)
+                    lastId = patient.id;
+                hashTable.put(patient.id, patient);
+                patients.push_back(std::move(patient));
+            });
+        tree.insertBulk(std::move(patients));
+        quarantine = std::move(reader.quarantine);
+        t.end();
+
+        // Snapshot hanya untuk mempercepat pemuatan berikutnya, kegagalan menulis tidak mengganggu aplikasi
+        try
+        {
+            if (hasSource)
+                SaveTreeSnapshot(snapshotPath, source, snapshotRecordVersion, tree, WritePatient);
+        }
+        catch (const std::domain_error &)
         {
-            HospitalPatient patient{
-                Utils::stringviewToWstring(reader.data[idIndex]),
-                Utils::stringviewToWstring(reader.data[nameIndex]),
-                PatientGroup(reader.data[groupIndex].begin[0] - 'A'),
-                Utils::DateStrToSystemTime(Utils::stringviewToWstring(reader.data[startIndex])),
-                Utils::DateStrToSystemTime(Utils::stringviewToWstring(reader.data[endIndex])),
-            };
-            if (patient.id > lastId)
-                lastId = patient.id;
-            hashTable.put(patient.id, patient);
-            tree.insert(std::move(patient));
         }
-        t.end();
 
-        statusBar.SetText(1, L"Pemuatan CSV selesai dalam " + t.durationStr());
+        statusBar.SetText(1, L"Pemuatan CSV selesai dalam " + t.durationStr() + QuarantineStr());
         progress.SetWaiting(false);
     }
 
@@ -1112,6 +1383,7 @@ void ClearAllList()
     TabAllPatient::listView.SetRowCount(0);
     TabFindRange::listView.SetRowCount(0);
     TabLongestDuration::listView.SetRowCount(0);
+    TabHistoryDelete::listView.SetRowCount(0);
 }
 
 void EnqueueRefreshAll(UI::Window *window)
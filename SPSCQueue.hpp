@@ -19,8 +19,8 @@ struct SPSCQueue {
     using CursorType = std::atomic<size_t>;
     static constexpr size_t align_size = 64;
 
-    alignas(align_size) CursorType _front;
-    alignas(align_size) CursorType _back;
+    alignas(align_size) CursorType _front{0};
+    alignas(align_size) CursorType _back{0};
     char _padding[align_size - sizeof(size_t)];
 
     explicit SPSCQueue(size_t capacity) {
@@ -0,0 +1,300 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include "HalfSipHash.h"
+#include "Winapi.hpp"
+
+/*
+    Snapshot biner dari data yang sudah dimuat dari CSV
+    Digunakan agar aplikasi tidak perlu membaca ulang CSV setiap kali dibuka
+
+    Format file:
+    - magic "SNAP" (4 byte)
+    - versi format snapshot (sSnapshotVersion)
+    - versi record, ditentukan oleh aplikasi, dinaikkan jika isi record berubah
+    - ukuran wchar_t
+    - ukuran dan waktu modifikasi terakhir file CSV sumber
+    - jumlah record, ukuran payload, dan checksum (HalfSipHash) dari header dan payload
+    - payload berisi record yang ditulis oleh aplikasi
+
+    Snapshot dianggap basi (stale) jika salah satu versi berbeda atau file CSV sumber berubah
+    Snapshot yang basi atau rusak diabaikan dan aplikasi kembali membaca CSV
+*/
+
+constexpr uint32_t sSnapshotVersion = 2;
+const char sSnapshotMagic[4] = {'S', 'N', 'A', 'P'};
+
+/**
+ * Identitas file CSV sumber, digunakan untuk mendeteksi snapshot basi
+ */
+struct SnapshotSource
+{
+    uint64_t size = 0;
+    uint64_t modified = 0;
+
+    bool read(const std::string &path)
+    {
+        WIN32_FILE_ATTRIBUTE_DATA attributes;
+        if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &attributes))
+            return false;
+
+        size = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+        modified = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+        return true;
+    }
+};
+
+struct SnapshotHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t recordVersion;
+    uint32_t wcharSize;
+    uint64_t sourceSize;
+    uint64_t sourceModified;
+    uint64_t recordCount;
+    uint64_t payloadSize;
+    uint64_t checksum;
+};
+
+inline uint64_t SnapshotChecksum(const char *data, size_t size)
+{
+    const uint64_t key = 0x5e1f0a73c92d4b61;
+    return HalfSipHash_64(data, size, &key);
+}
+
+/**
+ * Checksum snapshot mencakup seluruh field header, bukan hanya payload
+ * Field checksum pada header diisi checksum payload lalu header di-hash,
+ * sehingga jumlah record dan ukuran payload yang rusak juga terdeteksi
+ */
+inline uint64_t SnapshotChecksum(SnapshotHeader header, const char *payload, size_t size)
+{
+    header.checksum = SnapshotChecksum(payload, size);
+    return SnapshotChecksum(reinterpret_cast<const char *>(&header), sizeof(header));
+}
+
+/**
+ * Penulis snapshot
+ * Record ditulis ke payload di memori, kemudian save menulis header dan payload sekaligus
+ */
+struct SnapshotWriter
+{
+    std::vector<char> payload;
+    uint64_t recordCount = 0;
+
+    template <typename T>
+    void writePod(const T &value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "writePod need trivially copyable type");
+        const char *p = reinterpret_cast<const char *>(&value);
+        payload.insert(payload.end(), p, p + sizeof(T));
+    }
+
+    void writeWString(const std::wstring &value)
+    {
+        writePod(static_cast<uint32_t>(value.size()));
+        const char *p = reinterpret_cast<const char *>(value.data());
+        payload.insert(payload.end(), p, p + value.size() * sizeof(wchar_t));
+    }
+
+    // Dipanggil sekali setelah satu record selesai ditulis
+    void endRecord()
+    {
+        recordCount++;
+    }
+
+    /**
+     * Menulis snapshot ke path
+     * File ditulis ke path.tmp terlebih dahulu lalu dipindahkan,
+     * sehingga snapshot lama tidak rusak jika penulisan gagal di tengah jalan
+     */
+    void save(const std::string &path, const SnapshotSource &source, uint32_t recordVersion)
+    {
+        SnapshotHeader header;
+        memcpy(header.magic, sSnapshotMagic, sizeof(header.magic));
+        header.version = sSnapshotVersion;
+        header.recordVersion = recordVersion;
+        header.wcharSize = sizeof(wchar_t);
+        header.sourceSize = source.size;
+        header.sourceModified = source.modified;
+        header.recordCount = recordCount;
+        header.payloadSize = payload.size();
+        header.checksum = 0;
+        header.checksum = SnapshotChecksum(header, payload.data(), payload.size());
+
+        std::string tmpPath = path + ".tmp";
+        {
+            std::ofstream stream(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!stream)
+                throw std::domain_error("Cannot create snapshot");
+
+            stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+            stream.write(payload.data(), payload.size());
+
+            if (!stream)
+                throw std::domain_error("Snapshot write fail");
+        }
+
+        if (!MoveFileExA(tmpPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING))
+            throw std::domain_error("Snapshot rename fail");
+    }
+};
+
+/**
+ * Pembaca snapshot
+ * open membaca seluruh file dan memvalidasi header serta checksum
+ * Fungsi read melempar std::domain_error jika payload habis sebelum waktunya
+ */
+struct SnapshotReader
+{
+    std::vector<char> payload;
+    size_t cursor = 0;
+    uint64_t recordCount = 0;
+
+    /**
+     * Mengembalikan false jika snapshot tidak ada, rusak, atau basi
+     */
+    bool open(const std::string &path, const SnapshotSource &source, uint32_t recordVersion)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+            return false;
+
+        SnapshotHeader header;
+        if (!stream.read(reinterpret_cast<char *>(&header), sizeof(header)))
+            return false;
+
+        if (memcmp(header.magic, sSnapshotMagic, sizeof(header.magic)) != 0 ||
+            header.version != sSnapshotVersion ||
+            header.recordVersion != recordVersion ||
+            header.wcharSize != sizeof(wchar_t))
+            return false;
+
+        if (header.sourceSize != source.size || header.sourceModified != source.modified)
+            return false;
+
+        // Header belum diverifikasi checksum, ukuran dicek terhadap file sebelum alokasi
+        // Setiap record berisi minimal satu byte sehingga jumlah record tidak melebihi ukuran payload
+        stream.seekg(0, std::ios::end);
+        std::streamoff fileSize = stream.tellg();
+        if (fileSize < 0 || static_cast<uint64_t>(fileSize) - sizeof(header) != header.payloadSize ||
+            header.recordCount > header.payloadSize)
+            return false;
+
+        stream.seekg(sizeof(header), std::ios::beg);
+        payload.resize(static_cast<size_t>(header.payloadSize));
+        if (!stream.read(payload.data(), payload.size()))
+            return false;
+
+        if (SnapshotChecksum(header, payload.data(), payload.size()) != header.checksum)
+            return false;
+
+        cursor = 0;
+        recordCount = header.recordCount;
+        return true;
+    }
+
+    void need(size_t size)
+    {
+        if (payload.size() - cursor < size)
+            throw std::domain_error("Snapshot truncated");
+    }
+
+    template <typename T>
+    T readPod()
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "readPod need trivially copyable type");
+        need(sizeof(T));
+        T value;
+        memcpy(&value, payload.data() + cursor, sizeof(T));
+        cursor += sizeof(T);
+        return value;
+    }
+
+    std::wstring readWString()
+    {
+        uint32_t size = readPod<uint32_t>();
+        need(static_cast<size_t>(size) * sizeof(wchar_t));
+
+        std::wstring value(size, L'\0');
+        if (size > 0)
+            memcpy(&value[0], payload.data() + cursor, size * sizeof(wchar_t));
+        cursor += size * sizeof(wchar_t);
+        return value;
+    }
+
+    /**
+     * Membaca seluruh record dengan read, signature T read(SnapshotReader &reader)
+     * Mengembalikan false jika isi payload tidak sesuai dengan jumlah record
+     */
+    template <typename T, typename Read>
+    bool readAll(std::vector<T> &records, Read read)
+    {
+        records.clear();
+        records.reserve(recordCount);
+
+        try
+        {
+            for (uint64_t i = 0; i < recordCount; i++)
+                records.push_back(read(*this));
+        }
+        catch (const std::domain_error &)
+        {
+            records.clear();
+            return false;
+        }
+
+        return cursor == payload.size();
+    }
+};
+
+/**
+ * Menulis seluruh isi tree secara inorder (terurut) ke snapshot
+ * write dipanggil untuk setiap nilai, dengan signature void write(SnapshotWriter &writer, const T &value)
+ */
+template <typename Tree, typename Write>
+void SaveTreeSnapshot(const std::string &path, const SnapshotSource &source, uint32_t recordVersion, Tree &tree, Write write)
+{
+    SnapshotWriter writer;
+    tree.inorder(tree.root, [&](typename Tree::NodeType *node)
+                 {
+                     write(writer, node->value);
+                     writer.endRecord();
+                 });
+    writer.save(path, source, recordVersion);
+}
+
+/**
+ * Membangun ulang tree dari snapshot tanpa insert satu per satu
+ * Karena snapshot ditulis secara inorder, tree dibangun dengan buildFromSorted dalam O(n)
+ * read dipanggil untuk setiap record, dengan signature T read(SnapshotReader &reader)
+ * Mengembalikan false jika snapshot tidak bisa digunakan, tree tidak diubah
+ */
+template <typename Tree, typename Read>
+bool LoadTreeSnapshot(const std::string &path, const SnapshotSource &source, uint32_t recordVersion, Tree &tree, Read read)
+{
+    SnapshotReader reader;
+    std::vector<decltype(read(reader))> values;
+
+    if (!reader.open(path, source, recordVersion) || !reader.readAll(values, read))
+        return false;
+
+    try
+    {
+        tree.buildFromSorted(std::move(values));
+    }
+    catch (const std::domain_error &)
+    {
+        // Urutan di snapshot tidak sesuai comparer sekarang
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define UTF8_SSE2
+#endif
+
+/**
+ * Konversi UTF-8 ke wchar_t tanpa Winapi
+ * wchar_t berukuran 2 byte (Windows) menghasilkan UTF-16, wchar_t berukuran 4 byte (Linux) menghasilkan UTF-32
+ *
+ * Jalur cepat: 16 byte ASCII diperiksa dan diperlebar ke wchar_t sekaligus dengan SSE2
+ * Karakter non ASCII didekode satu per satu
+ * Urutan byte yang tidak valid diganti dengan U+FFFD seperti MultiByteToWideChar
+ *
+ * Jumlah wchar_t yang dihasilkan tidak pernah melebihi jumlah byte input,
+ * sehingga output cukup dialokasikan sebesar ukuran input tanpa perlu menghitung ukuran terlebih dahulu
+ */
+namespace Utf8
+{
+    const wchar_t replacementChar = 0xFFFD;
+
+    inline size_t putCodePoint(uint32_t cp, wchar_t *output)
+    {
+        if (sizeof(wchar_t) == 2 && cp >= 0x10000)
+        {
+            cp -= 0x10000;
+            output[0] = static_cast<wchar_t>(0xD800 + (cp >> 10));
+            output[1] = static_cast<wchar_t>(0xDC00 + (cp & 0x3FF));
+            return 2;
+        }
+
+        output[0] = static_cast<wchar_t>(cp);
+        return 1;
+    }
+
+    /**
+     * Mendekode satu karakter non ASCII yang dimulai dari in[0]
+     * Mengembalikan jumlah byte yang dibaca, minimal 1
+     */
+    inline size_t decodeMultiByte(const unsigned char *in, size_t size, wchar_t *output, size_t &written)
+    {
+        unsigned char c = in[0];
+        size_t length;
+        uint32_t cp, min;
+
+        if ((c & 0xE0) == 0xC0)
+        {
+            length = 2;
+            cp = c & 0x1F;
+            min = 0x80;
+        }
+        else if ((c & 0xF0) == 0xE0)
+        {
+            length = 3;
+            cp = c & 0x0F;
+            min = 0x800;
+        }
+        else if ((c & 0xF8) == 0xF0)
+        {
+            length = 4;
+            cp = c & 0x07;
+            min = 0x10000;
+        }
+        else
+        {
+            output[0] = replacementChar;
+            written = 1;
+            return 1;
+        }
+
+        if (length > size)
+        {
+            output[0] = replacementChar;
+            written = 1;
+            return 1;
+        }
+
+        for (size_t i = 1; i < length; i++)
+        {
+            if ((in[i] & 0xC0) != 0x80)
+            {
+                output[0] = replacementChar;
+                written = 1;
+                return 1;
+            }
+            cp = (cp << 6) | (in[i] & 0x3F);
+        }
+
+        if (cp < min || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF))
+        {
+            output[0] = replacementChar;
+            written = 1;
+            return 1;
+        }
+
+        written = putCodePoint(cp, output);
+        return length;
+    }
+
+#if defined(UTF8_SSE2)
+    // Memperlebar 16 byte ASCII menjadi 16 wchar_t
+    inline void widenAscii16(__m128i chunk, wchar_t *output)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i low = _mm_unpacklo_epi8(chunk, zero);
+        __m128i high = _mm_unpackhi_epi8(chunk, zero);
+
+        if (sizeof(wchar_t) == 2)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output), low);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 8), high);
+        }
+        else
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output), _mm_unpacklo_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 4), _mm_unpackhi_epi16(low, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 8), _mm_unpacklo_epi16(high, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(output + 12), _mm_unpackhi_epi16(high, zero));
+        }
+    }
+#endif
+
+    /**
+     * Mendekode input sebanyak size byte ke output
+     * output harus mempunyai kapasitas minimal size
+     * Mengembalikan jumlah wchar_t yang ditulis
+     */
+    inline size_t decode(const char *input, size_t size, wchar_t *output)
+    {
+        const unsigned char *in = reinterpret_cast<const unsigned char *>(input);
+        size_t i = 0, o = 0;
+
+        while (i < size)
+        {
+#if defined(UTF8_SSE2)
+            if (i + 16 <= size)
+            {
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+                int nonAscii = _mm_movemask_epi8(chunk);
+
+                if (nonAscii == 0)
+                {
+                    widenAscii16(chunk, output + o);
+                    i += 16;
+                    o += 16;
+                    continue;
+                }
+
+                // Salin ASCII sebelum karakter non ASCII pertama
+                while ((nonAscii & 1) == 0)
+                {
+                    output[o++] = in[i++];
+                    nonAscii >>= 1;
+                }
+            }
+#endif
+            if (in[i] < 0x80)
+            {
+                output[o++] = in[i++];
+                continue;
+            }
+
+            size_t written;
+            i += decodeMultiByte(in + i, size - i, output + o, written);
+            o += written;
+        }
+
+        return o;
+    }
+
+    inline void decodeInto(const char *input, size_t size, std::wstring &output)
+    {
+        output.resize(size);
+        if (size == 0)
+            return;
+        output.resize(decode(input, size, &output[0]));
+    }
+
+    inline std::wstring toWString(const char *input, size_t size)
+    {
+        std::wstring output;
+        decodeInto(input, size, output);
+        return output;
+    }
+}
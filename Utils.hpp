@@ -1,9 +1,28 @@
 #pragma once
 #include <string>
+#include <vector>
+#include <utility>
+#include <initializer_list>
 #include <cwctype>
-#include "Winapi.hpp"
+#include <climits>
+#include <algorithm>
+#include <cstring>
+#include <cstdint>
+#include "Utf8.hpp"
 #include <chrono>
 
+#ifdef _WIN32
+#include "Winapi.hpp"
+#else
+// Tanpa Winapi (generator data dan benchmark di Linux) hanya fungsi yang tidak memanggil Winapi yang tersedia
+typedef unsigned short WORD;
+
+struct SYSTEMTIME
+{
+    WORD wYear, wMonth, wDayOfWeek, wDay, wHour, wMinute, wSecond, wMilliseconds;
+};
+#endif
+
 namespace Utils
 {
     struct StringView
@@ -26,16 +45,176 @@ namespace Utils
 
     std::wstring stringviewToWstring(const StringView &view)
     {
-        if (view.size == 0)
-            return L"";
-        const size_t bufferSize = MultiByteToWideChar(CP_UTF8, 0, view.begin, static_cast<int>(view.size), NULL, 0);
+        return Utf8::toWString(view.begin, view.size);
+    }
 
-        if (bufferSize <= 0)
-            throw Winapi::Error("MultiByteToWideChar fail.");
+    /**
+     * Mengubah beberapa sel dari satu baris sekaligus
+     * cells berisi pasangan indeks kolom di row dan string tujuan
+     * Tahap pertama mengalokasikan semua string tujuan sesuai ukuran sel (batas atas jumlah wchar_t),
+     * tahap kedua mendekode setiap sel langsung ke string tujuannya lalu memotong ke panjang sebenarnya
+     * Memotong tidak mengalokasikan ulang, sehingga setiap string dialokasikan paling banyak sekali per baris
+     */
+    void stringviewsToWstrings(const std::vector<StringView> &row, std::initializer_list<std::pair<int, std::wstring *>> cells)
+    {
+        for (const std::pair<int, std::wstring *> &cell : cells)
+            cell.second->resize(row[cell.first].size);
 
-        std::wstring buffer(bufferSize, 0);
-        MultiByteToWideChar(CP_UTF8, 0, view.begin, static_cast<int>(view.size), const_cast<wchar_t *>(buffer.data()), bufferSize);
-        return buffer;
+        for (const std::pair<int, std::wstring *> &cell : cells)
+        {
+            const StringView &view = row[cell.first];
+            std::wstring &output = *cell.second;
+            if (view.size > 0)
+                output.resize(Utf8::decode(view.begin, view.size, &output[0]));
+        }
+    }
+
+    /**
+     * Parser bilangan bulat langsung dari StringView tanpa membuat wstring
+     * Format: tanda + atau - opsional lalu minimal satu digit, tanpa spasi
+     * Mengembalikan false jika format salah atau nilai melebihi batas int
+     */
+    bool parseInt(const StringView &view, int &out)
+    {
+        const char *p = view.begin;
+        const char *end = view.begin + view.size;
+        bool negative = false;
+
+        if (p != end && (*p == '-' || *p == '+'))
+        {
+            negative = *p == '-';
+            p++;
+        }
+
+        if (p == end)
+            return false;
+
+        // Batas dihitung dalam nilai negatif agar INT_MIN bisa dibaca
+        const long long limit = negative ? -static_cast<long long>(INT_MIN) : INT_MAX;
+        long long value = 0;
+
+        for (; p != end; p++)
+        {
+            unsigned digit = static_cast<unsigned char>(*p) - '0';
+            if (digit > 9)
+                return false;
+
+            value = value * 10 + digit;
+            if (value > limit)
+                return false;
+        }
+
+        out = static_cast<int>(negative ? -value : value);
+        return true;
+    }
+
+    /**
+     * Membaca angka tanpa tanda dari p sampai sebelum karakter bukan digit
+     * Mengembalikan jumlah digit yang dibaca
+     */
+    size_t parseDigits(const char *p, const char *end, unsigned &out)
+    {
+        const char *start = p;
+        out = 0;
+
+        // Maksimal 5 digit agar tidak overflow, cukup untuk hari, bulan, dan tahun
+        while (p != end && p - start < 5)
+        {
+            unsigned digit = static_cast<unsigned char>(*p) - '0';
+            if (digit > 9)
+                break;
+            out = out * 10 + digit;
+            p++;
+        }
+
+        return p - start;
+    }
+
+    /**
+     * Parser tanggal dd/mm/yyyy langsung dari StringView
+     * Format tetap 10 karakter dibaca tanpa perulangan
+     * Hari dan bulan 1 digit (format dari SystemTimeToDateStr) tetap diterima
+     * Mengembalikan false jika format salah atau hari/bulan di luar rentang
+     */
+    bool parseDate(const StringView &view, SYSTEMTIME &out)
+    {
+        const char *p = view.begin;
+        unsigned day, month, year;
+
+        if (view.size == 10 && p[2] == '/' && p[5] == '/')
+        {
+            unsigned d[8] = {
+                static_cast<unsigned>(static_cast<unsigned char>(p[0]) - '0'),
+                static_cast<unsigned>(static_cast<unsigned char>(p[1]) - '0'),
+                static_cast<unsigned>(static_cast<unsigned char>(p[3]) - '0'),
+                static_cast<unsigned>(static_cast<unsigned char>(p[4]) - '0'),
+                static_cast<unsigned>(static_cast<unsigned char>(p[6]) - '0'),
+                static_cast<unsigned>(static_cast<unsigned char>(p[7]) - '0'),
+                static_cast<unsigned>(static_cast<unsigned char>(p[8]) - '0'),
+                static_cast<unsigned>(static_cast<unsigned char>(p[9]) - '0')};
+
+            if ((d[0] | d[1] | d[2] | d[3] | d[4] | d[5] | d[6] | d[7]) > 9)
+                return false;
+
+            day = d[0] * 10 + d[1];
+            month = d[2] * 10 + d[3];
+            year = d[4] * 1000 + d[5] * 100 + d[6] * 10 + d[7];
+        }
+        else
+        {
+            const char *end = view.begin + view.size;
+            size_t length;
+
+            length = parseDigits(p, end, day);
+            if (length == 0 || length > 2 || p + length == end || p[length] != '/')
+                return false;
+            p += length + 1;
+
+            length = parseDigits(p, end, month);
+            if (length == 0 || length > 2 || p + length == end || p[length] != '/')
+                return false;
+            p += length + 1;
+
+            length = parseDigits(p, end, year);
+            if (length == 0 || length > 4 || p + length != end)
+                return false;
+        }
+
+        if (day < 1 || day > 31 || month < 1 || month > 12)
+            return false;
+
+        out = SYSTEMTIME{0};
+        out.wDay = static_cast<WORD>(day);
+        out.wMonth = static_cast<WORD>(month);
+        out.wYear = static_cast<WORD>(year);
+        return true;
+    }
+
+    /**
+     * Parser enum dari nama, names[i] adalah nama untuk nilai enum i
+     * names boleh berupa std::string atau std::wstring berisi ASCII
+     * Mengembalikan false jika tidak ada nama yang sama
+     */
+    template <typename E, typename S>
+    bool parseEnum(const StringView &view, const S *names, size_t count, E &out)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            if (names[i].size() != view.size)
+                continue;
+
+            size_t j = 0;
+            while (j < view.size && names[i][j] == static_cast<unsigned char>(view.begin[j]))
+                j++;
+
+            if (j == view.size)
+            {
+                out = static_cast<E>(i);
+                return true;
+            }
+        }
+
+        return false;
     }
 
     // Urutan karakter AaBbCcDd
@@ -65,6 +244,95 @@ namespace Utils
         return a.size() < b.size() ? -1 : 1;
     }
 
+    /**
+     * Mengembalikan true jika value berawalan prefix (peka huruf besar kecil)
+     * Dengan urutan CompareWStringHalfInsensitive, semua string yang berawalan prefix selalu berurutan
+     * dimulai dari prefix itu sendiri
+     */
+    bool StartsWith(const std::wstring &value, const std::wstring &prefix)
+    {
+        return value.size() >= prefix.size() && value.compare(0, prefix.size(), prefix) == 0;
+    }
+
+    /**
+     * Menambahkan kunci urutan value ke key
+     * Setiap karakter c diberi bobot towlower(c) * 2 + 1 jika c huruf kecil (atau tidak berhuruf besar kecil)
+     * dan towlower(c) * 2 jika huruf besar, sehingga membandingkan bobot sama dengan
+     * membandingkan karakter pada CompareWStringHalfInsensitive (AaBbCc)
+     * Bobot ditulis big-endian dengan panjang bervariasi yang tetap terurut saat dibandingkan per byte:
+     * 2 byte untuk bobot di bawah 0xF000 (byte pertama 0x00 - 0xEF), 3 byte dengan byte pertama 0xF0 - 0xFE,
+     * dan 6 byte dengan byte pertama 0xFF. Byte 00 00 tidak pernah muncul sebagai bobot
+     * Dua huruf besar berbeda dengan huruf kecil yang sama (misal K dan tanda Kelvin pada locale Unicode)
+     * tidak punya urutan yang konsisten pada CompareWStringHalfInsensitive, keduanya dianggap sama di sini
+     */
+    void AppendSortKey(std::string &key, const std::wstring &value)
+    {
+        key.reserve(key.size() + 2 * value.size());
+
+        for (wchar_t c : value)
+        {
+            uint64_t lower = static_cast<uint32_t>(std::towlower(c));
+            uint64_t weight = lower * 2 + (static_cast<uint32_t>(c) == lower ? 1 : 0);
+
+            if (weight < 0xF000)
+            {
+                key.push_back(static_cast<char>(weight >> 8));
+                key.push_back(static_cast<char>(weight));
+            }
+            else if (weight - 0xF000 < 0xF0000)
+            {
+                weight -= 0xF000;
+                key.push_back(static_cast<char>(0xF0 + (weight >> 16)));
+                key.push_back(static_cast<char>(weight >> 8));
+                key.push_back(static_cast<char>(weight));
+            }
+            else
+            {
+                key.push_back(static_cast<char>(0xFF));
+                for (int shift = 32; shift >= 0; shift -= 8)
+                    key.push_back(static_cast<char>(weight >> shift));
+            }
+        }
+    }
+
+    /**
+     * Kunci urutan biner dari first lalu second, dihitung sekali saat data dibuat
+     * CompareSortKey(SortKey(a1, a2), SortKey(b1, b2)) memberikan urutan yang sama dengan
+     * CompareWStringHalfInsensitive(a1, b1) lalu CompareWStringHalfInsensitive(a2, b2) jika sama
+     * Kedua bagian dipisahkan byte 00 00 yang lebih kecil dari bobot karakter mana pun
+     */
+    std::string SortKey(const std::wstring &first, const std::wstring &second)
+    {
+        std::string key;
+        AppendSortKey(key, first);
+        key.push_back(0);
+        key.push_back(0);
+        AppendSortKey(key, second);
+        return key;
+    }
+
+    std::string SortKey(const std::wstring &value)
+    {
+        std::string key;
+        AppendSortKey(key, value);
+        return key;
+    }
+
+    // Perbandingan kunci dari SortKey dengan memcmp, tanpa towlower per karakter
+    int CompareSortKey(const std::string &a, const std::string &b)
+    {
+        int compare = memcmp(a.data(), b.data(), std::min(a.size(), b.size()));
+
+        if (compare != 0)
+            return compare;
+
+        if (a.size() == b.size())
+            return 0;
+
+        return a.size() < b.size() ? -1 : 1;
+    }
+
+#ifdef _WIN32
     void CopyToClipboard(const std::wstring &data)
     {
         size_t sz = sizeof(wchar_t) * (data.length() + 1);
@@ -95,6 +363,7 @@ namespace Utils
         buffer.resize(lastIndex + 1);
         return buffer;
     }
+#endif
 
     std::wstring SystemTimeToDateStr(const SYSTEMTIME& in) {
         return std::to_wstring(in.wDay) + L"/" + std::to_wstring(in.wMonth) + L"/" + std::to_wstring(in.wYear);
@@ -115,6 +384,7 @@ namespace Utils
         return res;
     }
 
+#ifdef _WIN32
     LONGLONG SystemTimeTo100Nanos(const SYSTEMTIME& a) {
         FILETIME fa;
         if (!SystemTimeToFileTime(&a, &fa)) throw Winapi::Error("Convert systemtime fail");
@@ -136,4 +406,5 @@ namespace Utils
     int GetSystemDateDifferenceDays(const SYSTEMTIME& a, const SYSTEMTIME& b) {
         return std::chrono::duration_cast<std::chrono::hours>(GetSystemDateDifferenceNanos(a, b)).count() / 24;
     }
+#endif
 }
\ No newline at end of file
@@ -3,7 +3,18 @@
 #include <functional>
 #include <iostream>
 #include <atomic>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
 
+/**
+ * Tugas tulis (EnqueueWork) dijalankan satu per satu sesuai urutan di satu thread
+ * dan memegang _dataLock secara eksklusif selama berjalan
+ * Tugas baca (EnqueueRead) dijalankan bersamaan di thread pool baca dengan _dataLock bersama (shared),
+ * sehingga pencarian panjang tidak menghalangi pencarian lain
+ * Tugas baca tetap diserahkan sesuai urutan antrian: antrian menunggu sampai tugas baca memegang _dataLock bersama,
+ * sehingga tugas baca melihat semua tugas tulis yang dienqueue sebelumnya dan tidak melihat tugas tulis sesudahnya
+ */
 namespace WorkerThread
 {
     TP_CALLBACK_ENVIRON _environment;
@@ -11,6 +22,61 @@ namespace WorkerThread
     PTP_CLEANUP_GROUP _cleanupGroup = nullptr;
     std::atomic<int> _workCount;
 
+    TP_CALLBACK_ENVIRON _readEnvironment;
+    PTP_POOL _readPool = nullptr;
+    PTP_CLEANUP_GROUP _readCleanupGroup = nullptr;
+
+    // Melindungi data aplikasi (tree, hash table, kamus) yang diubah tugas tulis
+    SRWLOCK _dataLock = SRWLOCK_INIT;
+    // Diberi sinyal oleh tugas baca setelah memegang _dataLock bersama, lihat EnqueueRead
+    HANDLE _readLockedEvent = nullptr;
+    // Jumlah tugas tulis yang sudah selesai, diubah di bawah _dataLock eksklusif
+    uint64_t _writeVersion = 0;
+
+    /**
+     * Tugas baca di lane yang sama dijalankan satu per satu, misalnya refresh tab yang mengisi list view yang sama
+     * Tugas baca di lane berbeda berjalan bersamaan
+     *
+     * SRWLOCK tidak menjamin urutan (bukan FIFO), sehingga tugas baca yang lebih baru bisa mendapat lock lebih dulu
+     * Tugas baca yang lebih lama dari tugas baca terbaru yang sudah berjalan di lane yang sama dilewati,
+     * agar refresh lama tidak menimpa hasil refresh yang lebih baru
+     */
+    struct ReadLane
+    {
+        SRWLOCK lock = SRWLOCK_INIT;
+        // Nomor urut tugas baca terakhir yang diserahkan, hanya diubah di thread tulis
+        uint64_t submitted = 0;
+        // Nomor urut tugas baca terbaru yang sudah berjalan, dilindungi lock
+        uint64_t completed = 0;
+    };
+
+    /**
+     * Nilai yang ditulis tugas baca (misalnya rentang yang ditampilkan refresh) dan dibaca thread UI
+     * Dilindungi lock sendiri yang hanya dipegang selama menyalin nilai,
+     * sehingga thread UI tidak ikut menunggu tugas baca atau tugas tulis yang sedang berjalan
+     */
+    template <typename T>
+    struct Published
+    {
+        SRWLOCK lock = SRWLOCK_INIT;
+        T value = T();
+
+        void Set(const T &newValue)
+        {
+            AcquireSRWLockExclusive(&lock);
+            value = newValue;
+            ReleaseSRWLockExclusive(&lock);
+        }
+
+        T Get()
+        {
+            AcquireSRWLockShared(&lock);
+            T result = value;
+            ReleaseSRWLockShared(&lock);
+            return result;
+        }
+    };
+
     void Init()
     {
         InitializeThreadpoolEnvironment(&_environment);
@@ -31,6 +97,30 @@ namespace WorkerThread
 
         SetThreadpoolCallbackPool(&_environment, _pool);
         SetThreadpoolCallbackCleanupGroup(&_environment, _cleanupGroup, nullptr);
+
+        InitializeThreadpoolEnvironment(&_readEnvironment);
+
+        _readPool = CreateThreadpool(nullptr);
+
+        if (_readPool == nullptr)
+            throw Winapi::Error("CreateThreadPool failed");
+
+        SetThreadpoolThreadMaximum(_readPool, std::max<DWORD>(1, std::thread::hardware_concurrency()));
+        if (!SetThreadpoolThreadMinimum(_readPool, 1))
+            throw Winapi::Error("SetThreadpoolThreadMinimum failed");
+
+        _readCleanupGroup = CreateThreadpoolCleanupGroup();
+
+        if (_readCleanupGroup == nullptr)
+            throw Winapi::Error("CreateThreadpoolCleanupGroup failed");
+
+        SetThreadpoolCallbackPool(&_readEnvironment, _readPool);
+        SetThreadpoolCallbackCleanupGroup(&_readEnvironment, _readCleanupGroup, nullptr);
+
+        _readLockedEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+
+        if (_readLockedEvent == nullptr)
+            throw Winapi::Error("CreateEvent failed");
     }
 
     using WorkerType = std::function<void()>;
@@ -47,7 +137,7 @@ namespace WorkerThread
         _workCount--;
     }
 
-    void EnqueueWork(WorkerType &&worker)
+    void _Enqueue(WorkerType &&worker)
     {
         _workCount++;
         _queue.push(std::move(worker));
@@ -56,6 +146,85 @@ namespace WorkerThread
         SubmitThreadpoolWork(work);
     }
 
+    // Tugas yang mengubah data, dijalankan setelah semua tugas baca yang sedang berjalan selesai
+    void EnqueueWork(WorkerType &&worker)
+    {
+        _Enqueue([worker]()
+                 {
+                     AcquireSRWLockExclusive(&_dataLock);
+                     worker();
+                     _writeVersion++;
+                     ReleaseSRWLockExclusive(&_dataLock);
+                 });
+    }
+
+    /**
+     * Versi data, bertambah setiap kali tugas tulis selesai
+     * Hanya dipanggil di dalam tugas baca atau tugas tulis, sehingga nilainya tidak berubah selama tugas berjalan
+     * Dua tugas yang mendapat versi yang sama melihat data yang sama
+     */
+    uint64_t WriteVersion()
+    {
+        return _writeVersion;
+    }
+
+    struct _ReadWork
+    {
+        ReadLane *lane;
+        uint64_t sequence;
+        WorkerType worker;
+        // true jika thread tulis menunggu _readLockedEvent
+        bool signal;
+    };
+
+    VOID CALLBACK _ReadCallback(PTP_CALLBACK_INSTANCE instance, PVOID context)
+    {
+        _ReadWork *read = static_cast<_ReadWork *>(context);
+
+        // _dataLock diambil sebelum antrian lanjut ke tugas tulis berikutnya
+        AcquireSRWLockShared(&_dataLock);
+        if (read->signal)
+            SetEvent(_readLockedEvent);
+
+        AcquireSRWLockExclusive(&read->lane->lock);
+        if (read->sequence > read->lane->completed)
+        {
+            read->worker();
+            read->lane->completed = read->sequence;
+        }
+        ReleaseSRWLockExclusive(&read->lane->lock);
+        ReleaseSRWLockShared(&_dataLock);
+
+        delete read;
+        _workCount--;
+    }
+
+    /**
+     * Tugas yang hanya membaca data, boleh berjalan bersamaan dengan tugas baca lain
+     * Tugas diserahkan ke thread pool baca saat giliran di antrian tiba, setelah tugas tulis sebelumnya selesai,
+     * lalu antrian menunggu sampai tugas memegang _dataLock bersama sebelum menjalankan tugas tulis berikutnya
+     * Tugas tidak boleh mengubah data, dan hanya boleh mengubah state milik lane-nya (misalnya list view tab)
+     */
+    void EnqueueRead(ReadLane &lane, WorkerType &&worker)
+    {
+        ReadLane *readLane = &lane;
+        _Enqueue([readLane, worker]()
+                 {
+                     _workCount++;
+                     _ReadWork *read = new _ReadWork{readLane, ++readLane->submitted, worker, true};
+                     if (TrySubmitThreadpoolCallback(_ReadCallback, read, &_readEnvironment))
+                     {
+                         WaitForSingleObject(_readLockedEvent, INFINITE);
+                     }
+                     else
+                     {
+                         // Tidak dapat diserahkan, dijalankan di thread tulis
+                         read->signal = false;
+                         _ReadCallback(nullptr, read);
+                     }
+                 });
+    }
+
     bool IsWorking()
     {
         return _workCount > 0;
@@ -63,8 +232,15 @@ namespace WorkerThread
 
     void Destroy()
     {
+        // Tugas tulis lebih dulu karena dapat menyerahkan tugas baca
         CloseThreadpoolCleanupGroupMembers(_cleanupGroup, true, NULL);
         CloseThreadpoolCleanupGroup(_cleanupGroup);
         CloseThreadpool(_pool);
+
+        CloseThreadpoolCleanupGroupMembers(_readCleanupGroup, true, NULL);
+        CloseThreadpoolCleanupGroup(_readCleanupGroup);
+        CloseThreadpool(_readPool);
+
+        CloseHandle(_readLockedEvent);
     }
 }
\ No newline at end of file
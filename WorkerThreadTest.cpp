@@ -1,4 +1,5 @@
 #include "WorkerThread.hpp"
+#include <vector>
 
 void Work1()
 {
@@ -15,6 +16,28 @@ void Work3()
     std::cout << "Halo 3" << std::endl;
 }
 
+DWORD startTick;
+
+void Log(const std::string &text)
+{
+    // Satu kali tulis agar baris dari thread berbeda tidak tercampur
+    std::cout << (std::to_string(GetTickCount() - startTick) + " ms " + text + "\n") << std::flush;
+}
+
+void SlowRead()
+{
+    Log("Baca mulai");
+    Sleep(1000);
+    Log("Baca selesai");
+}
+
+void SlowWrite()
+{
+    Log("Tulis mulai");
+    Sleep(1000);
+    Log("Tulis selesai");
+}
+
 int main()
 {
     WorkerThread::Init();
@@ -45,4 +68,36 @@ int main()
     }
 
     Sleep(10000);
+
+    // 3 baca di lane berbeda mulai bersamaan, 2 baca di lane yang sama bergantian
+    // Tulis menunggu semua baca yang dienqueue sebelumnya (termasuk baca kedua di lane 2),
+    // baca terakhir mulai setelah tulis selesai
+    std::cout << "Test baca tulis" << std::endl;
+    WorkerThread::ReadLane lanes[3];
+    startTick = GetTickCount();
+    WorkerThread::EnqueueRead(lanes[0], SlowRead);
+    WorkerThread::EnqueueRead(lanes[1], SlowRead);
+    WorkerThread::EnqueueRead(lanes[2], SlowRead);
+    WorkerThread::EnqueueRead(lanes[2], SlowRead);
+    WorkerThread::EnqueueWork(SlowWrite);
+    WorkerThread::EnqueueRead(lanes[0], SlowRead);
+
+    while (WorkerThread::IsWorking())
+        Sleep(100);
+    Log("Selesai, seharusnya antara 4000 dan 5000 ms");
+
+    // Baca di lane yang sama tidak boleh berjalan mundur, baca lama yang tersusul dilewati
+    std::cout << "Test urutan lane" << std::endl;
+    std::vector<int> order;
+    for (int i = 0; i < 100; i++)
+    {
+        WorkerThread::EnqueueRead(lanes[0], [&order, i]()
+                                  { order.push_back(i); });
+    }
+
+    while (WorkerThread::IsWorking())
+        Sleep(100);
+
+    bool ordered = !order.empty() && order.back() == 99 && std::is_sorted(order.begin(), order.end());
+    std::cout << "Dijalankan " << order.size() << ", urut " << ordered << std::endl;
 }
\ No newline at end of file
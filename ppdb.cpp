@@ -10,30 +10,49 @@
 #include "WorkerThread.hpp"
 #include "TopKLargest.hpp"
 #include "UIUtils.hpp"
+#include "Dictionary.hpp"
 #include <stdlib.h>
 
 struct Student
 {
     std::wstring nisn;
     std::wstring name;
-    std::wstring origin;
-    std::wstring entry;
+    // Kode dari kamus origins dan entries
+    DictionaryCode origin;
+    DictionaryCode entry;
     std::wstring password;
+    // Kunci urutan NISN, diisi UpdateSortKey setiap NISN berubah
+    std::string sortKey;
 };
 
+void UpdateSortKey(Student &student)
+{
+    student.sortKey = Utils::SortKey(student.nisn);
+}
+
 struct StudentEntryComparer
 {
     int compare(const Student &a, const Student &b)
     {
-        int compare = Utils::CompareWStringHalfInsensitive(a.entry, b.entry);
+        // Jalur masuk yang sama dibandingkan dengan kode tanpa membandingkan string
+        int compare = Dictionary::compare(a.entry, b.entry);
 
         if (compare != 0)
             return compare;
 
-        return Utils::CompareWStringHalfInsensitive(a.nisn, b.nisn);
+        // Sama dengan CompareWStringHalfInsensitive NISN, melalui kunci urutan
+        return Utils::CompareSortKey(a.sortKey, b.sortKey);
     }
 };
 
+// Siswa batas untuk pencarian berdasarkan jalur masuk dan awalan NISN
+Student StudentBound(DictionaryCode entry, const std::wstring &nisn)
+{
+    Student student{nisn, L"", nullptr, entry};
+    UpdateSortKey(student);
+    return student;
+}
+
 struct StudentNISNHasher
 {
     uint64_t seed = 0xe17a1465;
@@ -43,8 +62,15 @@ struct StudentNISNHasher
     }
 };
 
+// Kunci hash table untuk putMany dan removeMany
+const std::wstring &StudentNISN(const Student &student)
+{
+    return student.nisn;
+}
+
 RBTree<Student, StudentEntryComparer> tree;
 RobinHoodHashMap<std::wstring, Student, StudentNISNHasher> hashTable;
+Dictionary origins, entries;
 RBTree<Student, StudentEntryComparer> removeHistoryTree;
 
 void ClearAllList();
@@ -70,6 +96,7 @@ namespace AddData
     UI::TextBox passwordTextBox;
     UI::Button btnAdd;
     Student student;
+    std::wstring originText, entryText;
 
     void SetEnable(boolean enable)
     {
@@ -81,7 +108,13 @@ namespace AddData
     {
         Timer t;
 
+        // List yang mengambil baris langsung dari tree tidak boleh dibaca saat tree diubah
+        ClearAllList();
+
         t.start();
+        student.origin = origins.intern(originText);
+        student.entry = entries.intern(entryText);
+        UpdateSortKey(student);
         hashTable.put(student.nisn, student);
         tree.insert(std::move(student));
         t.end();
@@ -96,9 +129,11 @@ namespace AddData
         student = Student{
             NISNTextBox.getText(),
             nameTextBox.getText(),
-            originTextBox.getText(),
-            entryTextBox.getText(),
+            nullptr,
+            nullptr,
             passwordTextBox.getText()};
+        originText = originTextBox.getText();
+        entryText = entryTextBox.getText();
 
         try
         {
@@ -138,11 +173,11 @@ namespace AddData
             {
                 throw std::domain_error("Nama Siswa Tidak Boleh Kosong");
             }
-            if (student.origin.size() == 0)
+            if (originText.size() == 0)
             {
                 throw std::domain_error("Asal Sekolah Siswa Tidak Boleh Kosong");
             }
-            if (student.entry.size() == 0)
+            if (entryText.size() == 0)
             {
                 throw std::domain_error("Jalur Masuk Siswa Tidak Boleh Kosong");
             }
@@ -215,8 +250,15 @@ namespace AddData
     }
 }
 
+/**
+ * Baris diambil langsung dari tree dengan select jika tree diisi (urutan inorder mulai dari treeFirst),
+ * sehingga tidak perlu menyalin pointer seluruh node setiap kali refresh
+ * Urutan lain (preorder, postorder, top K) tetap disalin ke items
+ */
 struct StudentListView : UI::VListView
 {
+    RBTree<Student, StudentEntryComparer> *tree = nullptr;
+    size_t treeFirst = 0;
     std::vector<Student *> items;
 
     void Create(UI::Window *window, HWND hParent, POINT pos, SIZE size) override
@@ -232,17 +274,42 @@ struct StudentListView : UI::VListView
         InsertColumn(L"Password", 100);
     }
 
+    Student *GetItem(int row)
+    {
+        if (tree != nullptr)
+            return &tree->select(treeFirst + row)->value;
+        return items[row];
+    }
+
+    // Menampilkan count nilai dari source mulai dari index first (inorder)
+    void ShowTree(RBTree<Student, StudentEntryComparer> *source, size_t first, size_t count)
+    {
+        SetRowCount(0);
+        std::vector<Student *>().swap(items);
+        tree = source;
+        treeFirst = first;
+        SetRowCount(count);
+    }
+
+    // Menampilkan isi items
+    void ShowItems()
+    {
+        SetRowCount(0);
+        tree = nullptr;
+        SetRowCount(items.size());
+    }
+
     const std::wstring OnGetItem(int row, int column) override
     {
-        Student *student = items[row];
+        Student *student = GetItem(row);
         if (column == 0)
             return student->nisn;
         else if (column == 1)
             return student->name;
         else if (column == 2)
-            return student->origin;
+            return Dictionary::get(student->origin);
         else if (column == 3)
-            return student->entry;
+            return Dictionary::get(student->entry);
         else if (column == 4)
             return student->password;
         return L"";
@@ -267,13 +334,15 @@ namespace TabHistoryDelete
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         progress.SetWaiting(true);
         message.ReplaceLastMessage(L"Memuat data");
 
         std::wstring type = combobox.GetSelectedText();
-        listView.items.resize(removeHistoryTree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -281,25 +350,31 @@ namespace TabHistoryDelete
         {
             timer.start();
 
-            size_t current = 0;
-            std::function<void(RBNode<Student> *)> visitor = [&](RBNode<Student> *node)
+            if (type == L"In-order")
             {
-                listView.items[current] = &node->value;
-                current++;
-            };
-
-            if (type == L"Pre-order")
-                removeHistoryTree.preorder(removeHistoryTree.root, visitor);
-            else if (type == L"In-order")
-                removeHistoryTree.inorder(removeHistoryTree.root, visitor);
-            else if (type == L"Post-order")
-                removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowTree(&removeHistoryTree, 0, removeHistoryTree.count);
+            }
+            else
+            {
+                listView.items.resize(removeHistoryTree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Student> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+
+                if (type == L"Pre-order")
+                    removeHistoryTree.preorder(removeHistoryTree.root, visitor);
+                else if (type == L"Post-order")
+                    removeHistoryTree.postorder(removeHistoryTree.root, visitor);
+                listView.ShowItems();
+            }
 
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(removeHistoryTree.count);
 
         message.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
         SetEnable(true);
@@ -309,7 +384,7 @@ namespace TabHistoryDelete
     {
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -326,21 +401,18 @@ namespace TabHistoryDelete
         std::vector<Student> students;
         for (int v : listView.GetSelectedIndex())
         {
-            students.push_back(*listView.items[v]);
+            students.push_back(*listView.GetItem(v));
         }
 
-        listView.SetRowCount(0);
+        ClearAllList();
 
         Timer t;
 
         t.start();
-        for (Student &student : students)
-        {
-            removeHistoryTree.remove(student);
-
-            hashTable.put(student.nisn, student);
-            tree.insert(std::move(student));
-        }
+        // Seluruh data yang dipilih diproses sekaligus di setiap struktur
+        removeHistoryTree.removeMany(students);
+        hashTable.putMany(students, StudentNISN);
+        tree.insertBulk(std::move(students));
         t.end();
 
         progress.SetWaiting(false);
@@ -353,7 +425,7 @@ namespace TabHistoryDelete
         UIUtils::MessageSetWait(&message);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoRestore);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -409,6 +481,36 @@ void DoRemove(Student &&Student, HWND window)
     removeHistoryTree.insert(std::move(Student));
 }
 
+/**
+ * Menghapus banyak data sekaligus: setiap struktur diproses sekali untuk seluruh data
+ * Tree disusun ulang sekali dan hash table diperkecil sekali, bukan setiap data
+ */
+void DoRemoveMany(std::vector<Student> &&students, HWND window)
+{
+    if (tree.removeMany(students) != students.size())
+        MessageBoxA(window, "Penghapusan di RBTree gagal", "Gagal", MB_OK);
+
+    if (hashTable.removeMany(students, StudentNISN) != students.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(students));
+}
+
+/**
+ * Menghapus seluruh data dalam rentang tree sekaligus
+ * Rentang dilepas dari tree dengan split dan join tanpa menghapus node satu per satu,
+ * lalu data yang dilepas dihapus dari hash table dan dimasukkan ke riwayat sekaligus
+ */
+void DoRemoveRange(RBTree<Student, StudentEntryComparer>::Range range, HWND window)
+{
+    std::vector<Student> students = tree.extractRange(range.begin(), range.end());
+
+    if (hashTable.removeMany(students, StudentNISN) != students.size())
+        MessageBoxA(window, "Penghapusan di RobinHoodHashTable gagal", "Gagal", MB_OK);
+
+    removeHistoryTree.insertBulk(std::move(students));
+}
+
 void DoRemoveByListViewSelection(StudentListView *listView, UI::ProgressBar *progress, UI::LabelWorkMessage *message)
 {
     progress->SetWaiting(true);
@@ -417,7 +519,7 @@ void DoRemoveByListViewSelection(StudentListView *listView, UI::ProgressBar *pro
     std::vector<Student> selectedStudent;
     for (int v : listView->GetSelectedIndex())
     {
-        selectedStudent.push_back(*listView->items[v]);
+        selectedStudent.push_back(*listView->GetItem(v));
     }
 
     ClearAllList();
@@ -425,10 +527,7 @@ void DoRemoveByListViewSelection(StudentListView *listView, UI::ProgressBar *pro
     Timer t;
 
     t.start();
-    for (Student &student : selectedStudent)
-    {
-        DoRemove(std::move(student), listView->_window->hwnd);
-    }
+    DoRemoveMany(std::move(selectedStudent), listView->_window->hwnd);
     t.end();
 
     message->ReplaceLastMessage(L"Penghapusan selesai dalam " + t.durationStr() + L". Penghapusan mungkin terlihat lama karena proses mendapatkan pilihan dari UI");
@@ -471,6 +570,9 @@ namespace TabStudentAuth
         btnAuth.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         label.ReplaceLastMessage(L"Menemukan data");
@@ -495,7 +597,7 @@ namespace TabStudentAuth
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnAuthClick(UI::CallbackParam param)
@@ -538,7 +640,7 @@ namespace TabFindStudentsRange
     UI::Label entryLabel, nisnLabel;
     UI::TextBox entryTextBox, nisnTextBox;
     UI::Button btnFind;
-    UI::Button btnAdd, btnDelete, btnCopynisn;
+    UI::Button btnAdd, btnDelete, btnDeleteRange, btnCopynisn;
     UI::ProgressBar progress;
     UI::LabelWorkMessage label;
     StudentListView listView;
@@ -550,34 +652,60 @@ namespace TabFindStudentsRange
         btnFind.SetEnable(enable);
         btnAdd.SetEnable(enable);
         btnDelete.SetEnable(enable);
+        btnDeleteRange.SetEnable(enable);
         btnCopynisn.SetEnable(enable);
         listView.SetEnable(enable);
     }
 
+    // Siswa dengan jalur masuk entry dan NISN berawalan nisn, rentang yang ditampilkan dan dihapus tab ini
+    RBTree<Student, StudentEntryComparer>::Range FindRange(const std::wstring &entry, const std::wstring &nisn)
+    {
+        // Jalur masuk yang tidak ada di kamus tidak mempunyai siswa
+        DictionaryCode entryCode = entries.find(entry);
+        if (entryCode == nullptr)
+            return {tree.end(), tree.end()};
+
+        return tree.prefixRange(StudentBound(entryCode, nisn), [&](const Student &student)
+                                { return student.entry == entryCode && Utils::StartsWith(student.nisn, nisn); });
+    }
+
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
+    // Batas dan jumlah hasil yang terakhir ditampilkan
+    // "Hapus Semua Hasil" menghapus rentang ini, bukan isi text box saat tombol ditekan
+    struct ShownRange
+    {
+        std::wstring entry, nisn;
+        size_t count;
+        // WorkerThread::WriteVersion saat hasil ditampilkan
+        uint64_t version;
+    };
+    // Ditulis DoRefresh di thread pool baca dan dibaca thread UI
+    WorkerThread::Published<ShownRange> shown;
+
     void DoRefresh()
     {
-        listView.items.clear();
         listView.SetRowCount(0);
 
         label.ReplaceLastMessage(L"Menemukan data");
         std::wstring entry = entryTextBox.getText(), nisn = nisnTextBox.getText();
         Timer timer;
 
-        std::wstring nisnEnd = nisn;
-        while (nisnEnd.size() <= 10)
-            nisnEnd.push_back('9');
-
         progress.SetWaiting(true);
 
         {
+            // Index batas rentang dicari dengan indexOf, baris diambil dari tree saat ditampilkan
             timer.start();
-            tree.findBetween(Student{nisn, L"", L"", entry}, {nisnEnd, L"", L"", entry}, [&](RBNode<Student> *node)
-                             { listView.items.push_back(&node->value); });
+            auto range = FindRange(entry, nisn);
+            size_t first = tree.indexOf(range.begin());
+            size_t last = tree.indexOf(range.end());
             timer.end();
+            listView.ShowTree(&tree, first, last > first ? last - first : 0);
+            shown.Set({entry, nisn, last > first ? last - first : 0, WorkerThread::WriteVersion()});
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data ditemukan dalam dalam " + timer.durationStr());
         progress.SetWaiting(false);
@@ -589,7 +717,7 @@ namespace TabFindStudentsRange
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam param)
@@ -608,7 +736,57 @@ namespace TabFindStudentsRange
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
+        EnqueueRefreshAll(&window);
+        return 0;
+    }
+
+    // Menghapus seluruh hasil pencarian rentang, bukan hanya yang dipilih
+    void DoDeleteRange(const ShownRange &range)
+    {
+        progress.SetWaiting(true);
+        label.ReplaceLastMessage(L"Menghapus rentang");
+
+        // Hanya rentang yang dikonfirmasi yang dihapus, batal jika data berubah setelah hasil ditampilkan
+        auto current = FindRange(range.entry, range.nisn);
+        size_t first = tree.indexOf(current.begin());
+        size_t last = tree.indexOf(current.end());
+        if (range.version != WorkerThread::WriteVersion() || (last > first ? last - first : 0) != range.count)
+        {
+            label.ReplaceLastMessage(L"Data berubah setelah hasil ditampilkan, tidak ada data yang dihapus");
+            UIUtils::MessageSetWait(&label, false);
+            progress.SetWaiting(false);
+            return;
+        }
+
+        ClearAllList();
+
+        Timer timer;
+        timer.start();
+        DoRemoveRange(current, window.hwnd);
+        timer.end();
+
+        label.ReplaceLastMessage(L"Penghapusan rentang selesai dalam " + timer.durationStr());
+        UIUtils::MessageSetWait(&label, false);
+        progress.SetWaiting(false);
+    }
+
+    LRESULT OnDeleteRangeClick(UI::CallbackParam param)
+    {
+        ShownRange range = shown.Get();
+        if (range.count == 0)
+            return 0;
+
+        std::wstring confirm = L"Hapus " + std::to_wstring(range.count) + L" data hasil pencarian? Data dapat dikembalikan dari riwayat penghapusan.";
+        if (MessageBoxW(window.hwnd, confirm.c_str(), L"Hapus Semua Hasil", MB_OKCANCEL | MB_ICONWARNING) != IDOK)
+            return 0;
+
+        // Rentang disalin ke tugas karena refresh berikutnya dapat mengganti rentang yang ditampilkan sebelum tugas berjalan
+        UIUtils::MessageSetWait(&label);
+        SetEnable(false);
+        WorkerThread::EnqueueWork([range]()
+                                  { DoDeleteRange(range); });
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -636,6 +814,9 @@ namespace TabFindStudentsRange
         btnDelete.SetText(L"Hapus Siswa");
         btnDelete.commandListener = OnDeleteClick;
 
+        btnDeleteRange.SetText(L"Hapus Semua Hasil");
+        btnDeleteRange.commandListener = OnDeleteRangeClick;
+
         window.controlsLayout = {
             {UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &entryLabel),
              UI::ControlCell(UI::SIZE_DEFAULT, UI::SIZE_DEFAULT, &entryTextBox),
@@ -648,7 +829,8 @@ namespace TabFindStudentsRange
             {UI::EmptyCell(UI::SIZE_FILL, UI::SIZE_DEFAULT),
              UI::ControlCell(100, UI::SIZE_DEFAULT, &btnCopynisn),
              UI::ControlCell(180, UI::SIZE_DEFAULT, &btnAdd),
-             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete)}};
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDelete),
+             UI::ControlCell(180, UI::SIZE_DEFAULT, &btnDeleteRange)}};
 
         UI::LayoutControls(&window, true);
 
@@ -684,11 +866,13 @@ namespace TabAllStudents
         listView.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         std::wstring type = combobox.GetSelectedText();
 
-        listView.items.resize(tree.count);
         listView.SetRowCount(0);
 
         Timer timer;
@@ -698,23 +882,30 @@ namespace TabAllStudents
 
         {
             timer.start();
-            size_t current = 0;
-            std::function<void(RBNode<Student> *)> visitor = [&](RBNode<Student> *node)
-            {
-                listView.items[current] = &node->value;
-                current++;
-            };
             if (type == L"In-order")
-                tree.inorder(tree.root, visitor);
-            else if (type == L"Pre-order")
-                tree.preorder(tree.root, visitor);
-            else if (type == L"Post-order")
-                tree.postorder(tree.root, visitor);
+            {
+                listView.ShowTree(&tree, 0, tree.count);
+            }
+            else
+            {
+                listView.items.resize(tree.count);
+                size_t current = 0;
+                auto visitor = [&](RBNode<Student> *node)
+                {
+                    listView.items[current] = &node->value;
+                    current++;
+                };
+
+                if (type == L"Pre-order")
+                    tree.preorder(tree.root, visitor);
+                else if (type == L"Post-order")
+                    tree.postorder(tree.root, visitor);
+                listView.ShowItems();
+            }
             timer.end();
         }
 
         progress.SetWaiting(false);
-        listView.SetRowCount(listView.items.size());
 
         label.ReplaceLastMessage(L"Data dimuat dalam " + timer.durationStr());
 
@@ -725,7 +916,7 @@ namespace TabAllStudents
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnShowClick(UI::CallbackParam param)
@@ -744,7 +935,7 @@ namespace TabAllStudents
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
         return 0;
     }
@@ -817,6 +1008,9 @@ namespace TabFindNISN
         btnDelete.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         label.ReplaceLastMessage(L"Mencari Siswa Berdasarkan NISN");
@@ -840,8 +1034,8 @@ namespace TabFindNISN
 
             listView.SetText(0, 1, currentStudent.nisn);
             listView.SetText(1, 1, currentStudent.name);
-            listView.SetText(2, 1, currentStudent.origin);
-            listView.SetText(3, 1, currentStudent.entry);
+            listView.SetText(2, 1, Dictionary::get(currentStudent.origin));
+            listView.SetText(3, 1, Dictionary::get(currentStudent.entry));
             listView.SetText(4, 1, currentStudent.password);
         }
         SetEnable(true);
@@ -851,7 +1045,7 @@ namespace TabFindNISN
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam)
@@ -882,7 +1076,7 @@ namespace TabFindNISN
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
 
         return 0;
@@ -953,6 +1147,9 @@ namespace TabFindEntry
         btnDelete.SetEnable(enable);
     }
 
+    // Refresh tab ini dijalankan satu per satu, refresh tab lain boleh berjalan bersamaan
+    WorkerThread::ReadLane lane;
+
     void DoRefresh()
     {
         label.ReplaceLastMessage(L"Mencari Siswa Berdasarkan NISN");
@@ -976,8 +1173,8 @@ namespace TabFindEntry
 
             listView.SetText(0, 1, currentStudent.nisn);
             listView.SetText(1, 1, currentStudent.name);
-            listView.SetText(2, 1, currentStudent.origin);
-            listView.SetText(3, 1, currentStudent.entry);
+            listView.SetText(2, 1, Dictionary::get(currentStudent.origin));
+            listView.SetText(3, 1, Dictionary::get(currentStudent.entry));
             listView.SetText(4, 1, currentStudent.password);
         }
         SetEnable(true);
@@ -987,7 +1184,7 @@ namespace TabFindEntry
     {
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
     }
 
     LRESULT OnFindClick(UI::CallbackParam)
@@ -1012,13 +1209,13 @@ namespace TabFindEntry
 
     LRESULT OnDeleteClick(UI::CallbackParam param)
     {
-        if (currentStudent.entry.empty())
+        if (currentStudent.entry == nullptr)
             return 0;
 
         UIUtils::MessageSetWait(&label);
         SetEnable(false);
         WorkerThread::EnqueueWork(DoDelete);
-        WorkerThread::EnqueueWork(DoRefresh);
+        WorkerThread::EnqueueRead(lane, DoRefresh);
         EnqueueRefreshAll(&window);
 
         return 0;
@@ -1136,6 +1333,7 @@ void ClearAllList()
 {
     TabAllStudents::listView.SetRowCount(0);
     TabFindStudentsRange::listView.SetRowCount(0);
+    TabHistoryDelete::listView.SetRowCount(0);
 }
 
 void EnqueueRefreshAll(UI::Window *callerWindow)